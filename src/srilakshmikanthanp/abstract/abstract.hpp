@@ -8,17 +8,18 @@
 #define SRILAKSHMIKANTHANP_LIBFIGLET_ABSTRACT_HPP
 
 #include "../types/types.hpp"
+#include "../utility/functions.hpp"
 
 #include <algorithm>
 #include <ostream>
 #include <string>
 #include <map>
 #include <iomanip>
-#include <regex>
 #include <vector>
 #include <memory>
 #include <fstream>
 #include <sstream>
+#include <string_view>
 
 namespace srilakshmikanthanp
 {
@@ -36,8 +37,12 @@ namespace srilakshmikanthanp
       using traits_type      =   typename string_type_t::traits_type;     // Traits Type
       using size_type        =   typename string_type_t::size_type;       // Size Type
 
-      using fig_char_type    =   std::vector<string_type_t>;              // Figlet char
-      using fig_str_type     =   std::vector<string_type_t>;              // Figlet String
+      using fig_char_type    =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type     =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;        // Figlet char view
+      using fig_params_type    =  basic_fig_params<char_type>;                        // Figlet params
 
     private:                                                              // private typedefs
       using sstream_type     =   std::basic_stringstream<char_type>;      // Sstream Type
@@ -49,9 +54,86 @@ namespace srilakshmikanthanp
     public:                                                               // public methods
 
       /**
-       * @brief Get the BasicFiglet character
+       * @brief Get the BasicFiglet character as view to the font
+       */
+      virtual fig_char_view_type get_fig_char_view(char_type ch) const = 0;
+
+      /**
+       * @brief Get the BasicFiglet character of the code point as view to the
+       * font (only the code points of char_type by default)
+       */
+      virtual fig_char_view_type get_code_view(char32_t code) const
+      {
+        // check
+        if (code != to_code(traits_type::to_char_type(static_cast<typename traits_type::int_type>(code))))
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+
+        // return
+        return this->get_fig_char_view(traits_type::to_char_type(static_cast<typename traits_type::int_type>(code)));
+      }
+
+      /**
+       * @brief Find the BasicFiglet character of the code point without throwing
+       *
+       * @details fonts of the library override this with a lookup, the
+       * default catches the error of get_code_view
+       *
+       * @return false if the font has no fig char for the code point
+       */
+      virtual bool find_code_view(char32_t code, fig_char_view_type &view) const
+      {
+        try
+        {
+          view = this->get_code_view(code);
+          return true;
+        }
+        catch (const std::exception &)
+        {
+          return false;
+        }
+      }
+
+      /**
+       * @brief Get the code points the font has fig chars for in increasing
+       * order (printable ascii by default)
+       */
+      virtual std::vector<char32_t> get_code_points() const
+      {
+        std::vector<char32_t> code_points;
+
+        for (char32_t code = ' '; code <= '~'; ++code)
+        {
+          code_points.push_back(code);
+        }
+
+        return code_points;
+      }
+
+      /**
+       * @brief Get the BasicFiglet character (copy of the view)
        */
-      virtual fig_char_type get_fig_char(char_type ch) const = 0;
+      virtual fig_char_type get_fig_char(char_type ch) const
+      {
+        // fig char view
+        const auto view = this->get_fig_char_view(ch);
+
+        // fig char container
+        fig_char_type fig_char;
+
+        // reserve the height
+        fig_char.reserve(view.size());
+
+        // copy the rows
+        for (size_type i = 0; i < view.size(); ++i)
+        {
+          fig_char.emplace_back(view[i]);
+        }
+
+        // return
+        return fig_char;
+      }
 
       /**
        * @brief Get the Hard Blank character
@@ -67,6 +149,79 @@ namespace srilakshmikanthanp
        * @brief Get the Shrink Level of font
        */
       virtual shrink_type get_shrink_level() const = 0;
+
+      /**
+       * @brief Get the horizontal layout of font (universal smushing by default)
+       */
+      virtual layout_type get_layout() const
+      {
+        switch (this->get_shrink_level())
+        {
+          case shrink_type::SMUSHED:
+            return fig_layout::SMUSHING;
+          case shrink_type::KERNING:
+            return fig_layout::KERNING;
+          default:
+            return 0;
+        }
+      }
+
+      /**
+       * @brief Get the parameters a fig string of the font is rendered with
+       */
+      fig_params_type get_params() const
+      {
+        return {this->get_hard_blank(), this->get_height(), this->get_layout()};
+      }
+    };
+
+    /**
+     * @brief Buffers of a render, kept by the caller and reused across renders
+     *
+     * @details the buffers allocate with the allocator of the string type,
+     * a buffer of std::pmr strings made with a memory resource renders
+     * without touching the heap once the resource holds enough memory
+     */
+    template <class string_type_t>
+    struct basic_render_buffer
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+      using allocator_type   =   typename string_type_t::allocator_type;  // Allocator Type
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;        // Figlet char view
+
+    public:                                                               // public members
+      basic_alloc_vector<string_type_t, fig_char_view_type> fig_chs;      // fig chars of the text
+      basic_fig_grid<string_type_t> fig_str;                              // rows of the fig string
+      basic_alloc_vector<string_type_t, string_view_type> fig_rows;       // rows of the fig char
+      basic_alloc_vector<string_type_t, size_type> trails;                // trailing spaces of the rows
+      basic_alloc_vector<string_type_t, size_type> widths;                // widths of the measured rows
+      string_type_t backs;                                                // last non space of the measured rows
+
+    public:                                                               // public constructors
+      basic_render_buffer() = default;                                    // default constructor
+
+      /**
+       * @brief Construct the buffers allocating from the allocator
+       */
+      explicit basic_render_buffer(const allocator_type &alloc)
+        : fig_chs(alloc), fig_str(alloc), fig_rows(alloc), trails(alloc), widths(alloc), backs(alloc)
+      {
+      }
+
+    public:                                                               // public methods
+      /**
+       * @brief Get the allocator of the buffers
+       */
+      allocator_type get_allocator() const
+      {
+        return this->backs.get_allocator();
+      }
     };
 
     /**
@@ -81,8 +236,16 @@ namespace srilakshmikanthanp
       using traits_type      =   typename string_type_t::traits_type;     // Traits Type
       using size_type        =   typename string_type_t::size_type;       // Size Type
 
-      using fig_char_type    =   std::vector<string_type_t>;              // Figlet char
-      using fig_str_type     =   std::vector<string_type_t>;              // Figlet String
+      using fig_char_type    =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type     =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;         // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;            // Figlet char view
+      using fig_chars_type     =  basic_alloc_vector<string_type_t, fig_char_view_type>;  // Figlet chars
+      using fig_char_rows_type =  basic_alloc_vector<string_type_t, string_view_type>;    // Figlet char rows
+      using fig_params_type    =  basic_fig_params<char_type>;                            // Figlet params
+      using fig_grid_type      =  basic_fig_grid<string_type_t>;                          // Figlet grid
+      using render_buffer_type =  basic_render_buffer<string_type_t>;                     // Render buffer
 
     private:                                                              // private typedefs
       using sstream_type     =   std::basic_stringstream<char_type>;      // Sstream Type
@@ -91,21 +254,18 @@ namespace srilakshmikanthanp
       using ifstream_type    =   std::basic_ifstream<char_type>;          // Ifstream Type
       using ofstream_type    =   std::basic_ofstream<char_type>;          // Ofstream Type
 
-    protected:                                                            // Protected Members
-      char_type hard_blank;                                               // hard blank character of the Figlet
-      size_type height;                                                   // height of the Figlet
-
     protected:                                                            // Protected Methods
       /**
        * @brief verify the height of the fig chars
        *
+       * @param params parameters of the font
        * @param fig_chs fig characters
        */
-      void verify_height(const std::vector<fig_char_type> &fig_chs) const
+      void verify_height(const fig_params_type &params, const fig_chars_type &fig_chs) const
       {
         for(const auto &fig_ch: fig_chs)
         {
-          if(fig_ch.size() != this->height)
+          if(fig_ch.size() != params.height)
           {
             throw std::runtime_error("Invalid Fig char Height");
           }
@@ -113,49 +273,107 @@ namespace srilakshmikanthanp
       }
 
       /**
-       * @brief removes hardblank from fig string
-       *
-       * @param figs fig string
-       * @param hb hardblank
+       * @brief Get the width of the fig chars side by side, no row of the
+       * fig string is wider as the styles only remove characters
        */
-      fig_str_type rm_hardblank(fig_str_type &figs) const
+      size_type full_width(const render_buffer_type &buffer) const
       {
-        for (size_type i = 0; i < figs.size(); ++i)
+        size_type width = 0;
+
+        for (const auto &fig_chr : buffer.fig_chs)
         {
-          std::replace(figs[i].begin(), figs[i].end(), this->hard_blank, traits_type::to_char_type(' '));
+          size_type widest = 0;
+
+          for (size_type i = 0; i < fig_chr.size(); ++i)
+          {
+            widest = std::max(widest, fig_chr[i].size());
+          }
+
+          width += widest;
         }
 
-        return figs;
+        return width;
       }
 
-    public:
-      basic_base_figlet_style(): hard_blank(' '), height(0) {}  // Default Constructor
+      /**
+       * @brief Clear the rows of the buffer keeping their capacity, the grid
+       * is sized for the fig chars of the buffer
+       *
+       * @param params parameters of the font
+       * @param buffer render buffer
+       */
+      void clear_buffer(const fig_params_type &params, render_buffer_type &buffer) const
+      {
+        buffer.fig_str.reset(params.height, this->full_width(buffer));
+        buffer.fig_rows.resize(params.height);
+        buffer.trails.assign(params.height, 0);
+      }
 
       /**
-       * @brief set the hard blank character of fig string
+       * @brief Get the width of the longest measured row of the buffer
        */
-      void set_hard_blank(char_type hb)
+      size_type max_width(const render_buffer_type &buffer) const
       {
-        this->hard_blank = hb;
+        size_type width = 0;
+
+        for (const auto row_width : buffer.widths)
+        {
+          width = std::max(width, row_width);
+        }
+
+        return width;
       }
 
       /**
-       * @brief set the height of fig string
+       * @brief removes hardblank from fig string in place
+       *
+       * @param params parameters of the font
+       * @param figs fig string
        */
-      void set_height(size_type h)
+      void rm_hardblank(const fig_params_type &params, fig_grid_type &figs) const
       {
-        this->height = h;
+        for (size_type i = 0; i < figs.size(); ++i)
+        {
+          std::replace(figs[i].begin(), figs[i].end(), params.hard_blank, traits_type::to_char_type(' '));
+        }
       }
 
+    public:
+      basic_base_figlet_style() = default;                                // Default Constructor
+
       /**
        * @brief Get the Shrink Level
        */
       virtual shrink_type get_shrink_level() const = 0;
 
+      /**
+       * @brief Render the fig chars of the buffer to the fig string of the buffer
+       *
+       * @details the style has no state, the parameters of the font are
+       * given on each render so a style can be shared by fonts and threads
+       */
+      virtual void render_fig_str(const fig_params_type &params, render_buffer_type &buffer) const = 0;
+
+      /**
+       * @brief Measure the width of the fig chars of the buffer without rendering
+       */
+      virtual size_type measure_fig_str(const fig_params_type &params, render_buffer_type &buffer) const = 0;
+
       /**
        * @brief Get the Fig string
        */
-      virtual fig_str_type get_fig_str(std::vector<fig_char_type> fig_chs) const = 0;
+      fig_str_type get_fig_str(const fig_params_type &params, const std::vector<fig_char_view_type> &fig_chs) const
+      {
+        // render buffer
+        render_buffer_type buffer;
+
+        // render
+        buffer.fig_chs.assign(fig_chs.begin(), fig_chs.end());
+        this->render_fig_str(params, buffer);
+
+        // return
+        return buffer.fig_str.to_rows();
+      }
     };
   }
 }
@@ -0,0 +1,293 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Header Guard
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_CACHE_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_CACHE_HPP
+
+#include "../driver/driver.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Counters of the render cache
+     */
+    struct render_cache_stats
+    {
+      std::uint64_t hits;                         // render served by the cache
+      std::uint64_t misses;                       // render that was rendered
+      std::uint64_t evictions;                    // results dropped for the capacity
+      std::size_t size;                           // results in the cache
+
+      /**
+       * @brief Get the ratio of hits to the renders
+       */
+      double hit_rate() const
+      {
+        return this->hits + this->misses == 0 ? 0.0 : double(this->hits) / double(this->hits + this->misses);
+      }
+    };
+
+    /**
+     * @brief Thread safe bounded cache of rendered figlet strings keyed by
+     * font, style, missing glyph policy and text
+     *
+     * @details keys are spread over shards by hash, each shard is a least
+     * recently used list under its own mutex so threads rendering different
+     * texts rarely wait for each other. A hit is one hash lookup in the
+     * shard, results are shared and immutable. Fonts and styles are held by
+     * weak pointer, a result of a destroyed font or style is never served.
+     */
+    template <class string_type_t>
+    class basic_render_cache
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+
+      using string_view_type =   std::basic_string_view<char_type, traits_type>;  // String View Type
+      using figlet_type      =   basic_figlet<string_type_t>;                     // Figlet Type
+      using result_type      =   std::shared_ptr<const string_type_t>;            // Result Type
+
+    private:                                                              // Private types definition
+      using font_type        =   basic_base_figlet_font<string_type_t>;   // Font Type
+      using style_type       =   basic_base_figlet_style<string_type_t>;  // Style Type
+
+      /**
+       * @brief Cached result
+       */
+      struct entry_type
+      {
+        std::size_t hash;                                                 // hash of the key
+        const font_type *font_key;                                        // font of the key
+        const style_type *style_key;                                      // style of the key
+        missing_glyph_type missing_key;                                   // missing glyph policy of the key
+        char32_t fallback_key;                                            // fallback code point of the key
+        std::weak_ptr<font_type> font;                                    // font still alive
+        std::weak_ptr<style_type> style;                                  // style still alive
+        string_type text;                                                 // text of the key
+        result_type value;                                                // rendered string
+      };
+
+      using list_type        =   std::list<entry_type>;                   // LRU list
+      using index_type       =   std::unordered_multimap<std::size_t, typename list_type::iterator>;
+
+      /**
+       * @brief Shard of the cache
+       */
+      struct shard_type
+      {
+        std::mutex mutex;                                                 // guards the shard
+        list_type entries;                                                // most recent first
+        index_type index;                                                 // entries by hash
+        render_cache_stats stats = {};                                    // counters of the shard
+      };
+
+    private:                                                              // Private members
+      std::vector<std::unique_ptr<shard_type>> shards;                    // shards of the cache
+      std::size_t shard_capacity;                                         // results per shard
+
+    private:                                                              // Private utilities
+      /**
+       * @brief Hash of the key
+       */
+      static std::size_t hash_of(const font_type *font, const style_type *style, missing_glyph_type missing, char32_t fallback, string_view_type text)
+      {
+        auto hash = std::hash<string_view_type>()(text);
+
+        hash ^= std::hash<const void *>()(font) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<const void *>()(style) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<int>()(static_cast<int>(missing)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<char32_t>()(fallback) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+      }
+
+      /**
+       * @brief Find the entry of the key in the shard (locked)
+       */
+      static typename list_type::iterator find(shard_type &shard, std::size_t hash, const font_type *font, const style_type *style, missing_glyph_type missing, char32_t fallback, string_view_type text)
+      {
+        const auto [begin, end] = shard.index.equal_range(hash);
+
+        for (auto itr = begin; itr != end; ++itr)
+        {
+          const auto &entry = *itr->second;
+
+          if (entry.font_key == font && entry.style_key == style && entry.missing_key == missing && entry.fallback_key == fallback && entry.text == text && !entry.font.expired() && !entry.style.expired())
+          {
+            return itr->second;
+          }
+        }
+
+        return shard.entries.end();
+      }
+
+      /**
+       * @brief Remove the entry from the shard (locked)
+       */
+      static void erase(shard_type &shard, typename list_type::iterator entry)
+      {
+        const auto [begin, end] = shard.index.equal_range(entry->hash);
+
+        for (auto itr = begin; itr != end; ++itr)
+        {
+          if (itr->second == entry)
+          {
+            shard.index.erase(itr);
+            break;
+          }
+        }
+
+        shard.entries.erase(entry);
+      }
+
+    public:                                                               // Public constructors
+      basic_render_cache() = delete;                                      // default constructor
+      basic_render_cache(const basic_render_cache &) = delete;            // copy constructor
+
+      /**
+       * @brief Construct a new render cache
+       *
+       * @param capacity maximum number of results
+       * @param shard_count number of shards
+       */
+      explicit basic_render_cache(std::size_t capacity, std::size_t shard_count = 16)
+      {
+        // check
+        if (capacity == 0 || shard_count == 0)
+        {
+          throw std::runtime_error("Invalid cache capacity");
+        }
+
+        // shards
+        shard_count = std::min(shard_count, capacity);
+        this->shard_capacity = (capacity + shard_count - 1) / shard_count;
+
+        for (std::size_t i = 0; i < shard_count; ++i)
+        {
+          this->shards.push_back(std::make_unique<shard_type>());
+        }
+      }
+
+    public:                                                               // Public methods
+      /**
+       * @brief Get the figlet string of the text, rendered on a miss
+       */
+      template <class instrument_type_t>
+      result_type render(const basic_figlet<string_type_t, instrument_type_t> &figlet, string_view_type text)
+      {
+        // key of the text
+        const auto font = figlet.get_font();
+        const auto style = figlet.get_style();
+        const auto missing = figlet.get_missing_glyph();
+        const auto fallback = figlet.get_fallback();
+        const auto hash = hash_of(font.get(), style.get(), missing, fallback, text);
+
+        // shard of the key
+        auto &shard = *this->shards[hash % this->shards.size()];
+
+        // find the result
+        {
+          std::lock_guard<std::mutex> lock(shard.mutex);
+
+          if (const auto itr = find(shard, hash, font.get(), style.get(), missing, fallback, text); itr != shard.entries.end())
+          {
+            shard.entries.splice(shard.entries.begin(), shard.entries, itr);
+            shard.stats.hits += 1;
+            return itr->value;
+          }
+        }
+
+        // render without the lock
+        string_type value;
+        figlet.render_into(text, value);
+
+        auto result = std::make_shared<const string_type>(std::move(value));
+
+        // add the result
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        // rendered by other thread
+        if (const auto itr = find(shard, hash, font.get(), style.get(), missing, fallback, text); itr != shard.entries.end())
+        {
+          shard.entries.splice(shard.entries.begin(), shard.entries, itr);
+          shard.stats.misses += 1;
+          return itr->value;
+        }
+
+        shard.entries.push_front({hash, font.get(), style.get(), missing, fallback, font, style, string_type(text), result});
+        shard.index.emplace(hash, shard.entries.begin());
+        shard.stats.misses += 1;
+
+        // evict the least recently used
+        while (shard.entries.size() > this->shard_capacity)
+        {
+          erase(shard, std::prev(shard.entries.end()));
+          shard.stats.evictions += 1;
+        }
+
+        shard.stats.size = shard.entries.size();
+
+        // return
+        return result;
+      }
+
+      /**
+       * @brief Drop all the results
+       */
+      void clear()
+      {
+        for (auto &shard : this->shards)
+        {
+          std::lock_guard<std::mutex> lock(shard->mutex);
+
+          shard->entries.clear();
+          shard->index.clear();
+          shard->stats.size = 0;
+        }
+      }
+
+      /**
+       * @brief Get the counters of all the shards
+       */
+      render_cache_stats get_stats() const
+      {
+        render_cache_stats stats = {};
+
+        for (const auto &shard : this->shards)
+        {
+          std::lock_guard<std::mutex> lock(shard->mutex);
+
+          stats.hits += shard->stats.hits;
+          stats.misses += shard->stats.misses;
+          stats.evictions += shard->stats.evictions;
+          stats.size += shard->stats.size;
+        }
+
+        return stats;
+      }
+    };
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_CACHE_HPP
@@ -8,27 +8,74 @@
 #define SRILAKSHMIKANTHANP_LIBFIGLET_DRIVER_HPP
 
 #include "../abstract/abstract.hpp"
+#include "../instrument/instrument.hpp"
 #include "../types/types.hpp"
+#include "../utility/parallel.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <ostream>
 #include <string>
 #include <map>
 #include <iomanip>
-#include <regex>
 #include <vector>
 #include <memory>
+#include <optional>
 #include <fstream>
 #include <sstream>
+#include <string_view>
+#include <stdexcept>
+#include <system_error>
 
 namespace srilakshmikanthanp
 {
   namespace libfiglet
   {
     /**
-     * @brief basic figlet class
+     * @brief Figlet strings of a batch in one contiguous arena
      */
     template <class string_type_t>
+    struct basic_render_batch
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+
+      using string_view_type =   std::basic_string_view<char_type, traits_type>;  // String View Type
+
+    public:                                                               // public members
+      string_type_t arena;                                                // figlet strings of the batch
+      std::vector<size_type> offsets;                                     // start of each figlet string and the end
+
+    public:                                                               // public methods
+      /**
+       * @brief Get the number of figlet strings
+       */
+      size_type size() const
+      {
+        return this->offsets.empty() ? 0 : this->offsets.size() - 1;
+      }
+
+      /**
+       * @brief Get the figlet string of the text at the index
+       */
+      string_view_type operator[](size_type i) const
+      {
+        return string_view_type(this->arena).substr(this->offsets[i], this->offsets[i + 1] - this->offsets[i]);
+      }
+    };
+
+    /**
+     * @brief basic figlet class
+     *
+     * @details the instrument is a compile time policy, with no_instrument
+     * (the default) the renders have no instrumentation at all, with an
+     * enabled instrument each render is timed by phase and recorded.
+     */
+    template <class string_type_t, class instrument_type_t = no_instrument>
     class basic_figlet
     {
     public:                                                               // public type definition
@@ -37,8 +84,16 @@ namespace srilakshmikanthanp
       using traits_type      =   typename string_type_t::traits_type;     // Traits Type
       using size_type        =   typename string_type_t::size_type;       // Size Type
 
-      using fig_char_type    =   std::vector<string_type_t>;              // Figlet char
-      using fig_str_type     =   std::vector<string_type_t>;              // Figlet String
+      using fig_char_type    =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type     =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;        // Figlet char view
+      using fig_params_type    =  basic_fig_params<char_type>;                        // Figlet params
+      using fig_grid_type      =  basic_fig_grid<string_type_t>;                      // Figlet grid
+      using render_buffer_type =  basic_render_buffer<string_type_t>;                 // Render buffer
+      using render_batch_type  =  basic_render_batch<string_type_t>;                  // Render batch
+      using instrument_type    =  instrument_type_t;                                  // Instrument Type
 
     private:                                                              // private typedefs
       using sstream_type     =   std::basic_stringstream<char_type>;      // Sstream Type
@@ -54,6 +109,14 @@ namespace srilakshmikanthanp
     private:                                                              // Private members
       base_figlet_style_ptr style;                                        // Figlet Style
       base_figlet_font_ptr font;                                          // Figlet Font
+      fig_params_type params;                                             // Params of the Font
+
+      missing_glyph_type missing_glyph = missing_glyph_type::FAIL;        // Missing glyph policy
+      char32_t fallback_code = 0;                                         // Code of the fallback
+      fig_char_view_type fallback;                                        // Fallback fig char
+      bool has_fallback = false;                                          // Font has the fallback
+
+      instrument_type_t instrument;                                       // Instrument of the renders
 
     private:                                                              // private utilities
       /**
@@ -69,11 +132,440 @@ namespace srilakshmikanthanp
         this->style = style; // Set style
         this->font = font;   // Set font
 
-        // Set the height of the style
-        this->style->set_height(this->font->get_height());
+        // Params of the font given to the style on each render, the style
+        // is not changed so it can be shared by figlets of other fonts
+        this->params = this->font->get_params();
+
+        // Fallback fig char of the font
+        this->has_fallback = this->font->find_code_view(this->fallback_code, this->fallback);
+      }
+
+      /**
+       * @brief Get the bytes held by each buffer of the render
+       */
+      static std::array<std::size_t, 4> get_capacities(const render_buffer_type &buffer)
+      {
+        return {
+          buffer.fig_chs.capacity() * sizeof(fig_char_view_type),
+          buffer.fig_str.capacity() * sizeof(char_type),
+          buffer.fig_rows.capacity() * sizeof(string_view_type),
+          buffer.trails.capacity() * sizeof(size_type)
+        };
+      }
+
+      /**
+       * @brief Load the fig chars with the loader and lay out the rows, the
+       * phases are timed into the event when the instrument is enabled
+       *
+       * @return false if the loader fails
+       */
+      template <class loader_type>
+      bool render_rows(string_view_type str, render_buffer_type &buffer, render_event &event, loader_type loader) const
+      {
+        // not instrumented
+        if constexpr (!instrument_type_t::enabled)
+        {
+          if (!loader())
+          {
+            return false;
+          }
+
+          this->style->render_fig_str(this->params, buffer);
+          return true;
+        }
+        else
+        {
+          // buffers before the render
+          const auto before = get_capacities(buffer);
+
+          // look up and lay out
+          const auto start = instrument_clock_ns();
+          const auto loaded = loader();
+          const auto lookup = instrument_clock_ns();
+
+          if (loaded)
+          {
+            this->style->render_fig_str(this->params, buffer);
+          }
+
+          const auto layout = instrument_clock_ns();
+
+          // code points of the text
+          for (auto itr = str.begin(); itr != str.end(); ++event.decoded_code_points)
+          {
+            next_code(itr, str.end());
+          }
+
+          // phases
+          event.input_size = str.size();
+          event.glyphs = buffer.fig_chs.size();
+          event.shrink = this->style->get_shrink_level();
+          event.lookup_ns = lookup - start;
+          event.layout_ns = layout - lookup;
+          event.failed = !loaded;
+
+          // size of the rows
+          event.height = loaded ? buffer.fig_str.size() : 0;
+          event.output_size = loaded ? buffer.fig_str.joined_size() : 0;
+
+          for (size_type i = 0; i < event.height; ++i)
+          {
+            event.width = std::max<std::size_t>(event.width, buffer.fig_str[i].size());
+          }
+
+          // buffers that grew
+          const auto after = get_capacities(buffer);
+
+          for (std::size_t i = 0; i < after.size(); ++i)
+          {
+            if (after[i] > before[i])
+            {
+              event.buffer_growths += 1;
+              event.buffer_growth_bytes += after[i] - before[i];
+            }
+          }
+
+          return loaded;
+        }
+      }
+
+      /**
+       * @brief Load the fig chars of the text and lay out the rows, throws if
+       * the render fails with the missing glyph policy
+       */
+      void render_text(string_view_type str, render_buffer_type &buffer, render_event &event) const
+      {
+        if (char32_t code = 0; !this->render_rows(str, buffer, event, [&] { return this->load_fig_chs(str, buffer, code); }))
+        {
+          this->record(event);
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+      }
+
+      /**
+       * @brief Join the rows to the output with the assembler and record the
+       * event when the instrument is enabled
+       *
+       * @param output string the assembler writes (its growth is counted) or null
+       */
+      template <class assembler_type>
+      void assemble(render_event &event, const string_type *output, assembler_type assembler) const
+      {
+        // not instrumented
+        if constexpr (!instrument_type_t::enabled)
+        {
+          assembler();
+        }
+        else
+        {
+          // output before the assembly
+          const auto capacity = output ? output->capacity() : 0;
+
+          // join
+          const auto start = instrument_clock_ns();
+          assembler();
+          event.assembly_ns = instrument_clock_ns() - start;
+
+          // output that grew
+          if (output && output->capacity() > capacity)
+          {
+            event.buffer_growths += 1;
+            event.buffer_growth_bytes += (output->capacity() - capacity) * sizeof(char_type);
+          }
+
+          // record
+          this->instrument.record(event);
+        }
+      }
+
+      /**
+       * @brief Record the event when the instrument is enabled
+       */
+      void record(const render_event &event) const
+      {
+        if constexpr (instrument_type_t::enabled)
+        {
+          this->instrument.record(event);
+        }
+      }
+
+      /**
+       * @brief Add the fig char of the code point the font has no fig char for
+       *
+       * @return false if the render fails
+       */
+      bool add_missing(render_buffer_type &buffer) const
+      {
+        switch (this->missing_glyph)
+        {
+          case missing_glyph_type::SUBSTITUTE:
+            if (this->has_fallback)
+            {
+              buffer.fig_chs.push_back(this->fallback);
+            }
+            return true;
+          case missing_glyph_type::SKIP:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+      /**
+       * @brief Get the fig chars of printable ascii, looked up once for a batch
+       */
+      std::vector<fig_char_view_type> get_glyphs() const
+      {
+        std::vector<fig_char_view_type> glyphs('~' - ' ' + 1);
+
+        // missing ones are empty and take the slow path
+        for (char32_t code = ' '; code <= '~'; ++code)
+        {
+          this->font->find_code_view(code, glyphs[code - ' ']);
+        }
+
+        return glyphs;
+      }
+
+      /**
+       * @brief Transform the text to fig chars of the buffer, the text is
+       * decoded to code points (UTF-8 for char)
+       *
+       * @param missing code point without fig char when the render fails
+       * @return false if the render fails with the missing glyph policy
+       */
+      bool load_fig_chs(string_view_type str, render_buffer_type &buffer, char32_t &missing) const
+      {
+        buffer.fig_chs.clear();
+
+        // fig char of the code point
+        fig_char_view_type view;
+
+        for (auto itr = str.begin(); itr != str.end();)
+        {
+          const auto code = next_code(itr, str.end());
+
+          if (this->font->find_code_view(code, view))
+          {
+            buffer.fig_chs.push_back(view);
+          }
+          else if (!this->add_missing(buffer))
+          {
+            missing = code;
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      /**
+       * @brief Transform the text to fig chars of the buffer with the glyphs
+       * of printable ascii
+       *
+       * @return false if the render fails with the missing glyph policy
+       */
+      bool load_fig_chs(string_view_type str, const std::vector<fig_char_view_type> &glyphs, render_buffer_type &buffer) const
+      {
+        buffer.fig_chs.clear();
+
+        // fig char of the code point
+        fig_char_view_type view;
+
+        for (auto itr = str.begin(); itr != str.end();)
+        {
+          // ascii fast path
+          if (const auto unit = to_code(*itr); unit - ' ' <= char32_t('~' - ' ') && glyphs[unit - ' '].size() != 0)
+          {
+            buffer.fig_chs.push_back(glyphs[unit - ' ']);
+            ++itr;
+          }
+          else if (const auto code = next_code(itr, str.end()); this->font->find_code_view(code, view))
+          {
+            buffer.fig_chs.push_back(view);
+          }
+          else if (!this->add_missing(buffer))
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      /**
+       * @brief Render the texts in order into the arena in parallel
+       *
+       * @details on a single thread the texts are rendered straight to the
+       * end of the arena. On more threads the texts are measured in blocks
+       * claimed by the threads, the arena is sized once from the measured
+       * rows and each text is then rendered straight to its place in the
+       * arena, so nothing is copied between the render and the arena. The
+       * figlet string of text i is [offsets[i], offsets[i + 1]).
+       *
+       * @param missing code point without fig char of the first text that fails
+       * @return false if a text fails with the missing glyph policy, the
+       * arena and the offsets are empty then
+       */
+      bool render_all(const std::vector<string_view_type> &texts, string_type &arena, std::vector<size_type> &offsets, std::size_t threads, char32_t &missing) const
+      {
+        // texts per task
+        constexpr std::size_t block = 64;
+
+        // blocks of texts
+        const auto blocks = (texts.size() + block - 1) / block;
+
+        // fig chars of the batch
+        const auto glyphs = this->get_glyphs();
+
+        // first text that fails (the size of the texts if none)
+        std::atomic<std::size_t> failed(texts.size());
+
+        // size of each figlet string
+        offsets.assign(texts.size() + 1, 0);
+        arena.clear();
+
+        // render straight to the end of the arena
+        if (thread_count(threads, blocks) == 1)
+        {
+          render_buffer_type buffer(arena.get_allocator());
+
+          for (std::size_t i = 0; i < texts.size(); ++i)
+          {
+            render_event event = {};
+
+            if (!this->render_rows(texts[i], buffer, event, [&] { return this->load_fig_chs(texts[i], glyphs, buffer); }))
+            {
+              this->record(event);
+              failed = i;
+              break;
+            }
 
-        // Set the hard blank of the style
-        this->style->set_hard_blank(this->font->get_hard_blank());
+            this->assemble(event, &arena, [&] { arena += buffer.fig_str.join(); });
+
+            offsets[i + 1] = arena.size();
+          }
+        }
+        else
+        {
+          // size of each figlet string from the measured rows (the buffers of
+          // the threads use the default allocator, a memory resource of the
+          // arena need not be thread safe)
+          parallel_for(blocks, threads, [&](std::size_t b) {
+            render_buffer_type buffer;
+
+            for (auto i = b * block; i < std::min(texts.size(), (b + 1) * block); ++i)
+            {
+              // keep the first text that fails
+              if (!this->load_fig_chs(texts[i], glyphs, buffer))
+              {
+                auto first = failed.load();
+
+                while (i < first && !failed.compare_exchange_weak(first, i))
+                {
+                  // first is reloaded
+                }
+
+                break;
+              }
+
+              this->style->measure_fig_str(this->params, buffer);
+
+              // rows and their new lines
+              offsets[i + 1] = buffer.widths.size();
+
+              for (const auto width : buffer.widths)
+              {
+                offsets[i + 1] += width;
+              }
+            }
+          });
+        }
+
+        // a text failed, its code point is found again
+        if (failed != texts.size())
+        {
+          render_buffer_type buffer;
+          this->load_fig_chs(texts[failed], buffer, missing);
+          arena.clear();
+          offsets.assign(1, 0);
+          return false;
+        }
+
+        // rendered on a single thread
+        if (thread_count(threads, blocks) == 1)
+        {
+          return true;
+        }
+
+        // offsets in the arena
+        for (std::size_t i = 0; i < texts.size(); ++i)
+        {
+          offsets[i + 1] += offsets[i];
+        }
+
+        // size the arena once
+        arena.resize(offsets.back());
+
+        // render each text to its place in the arena
+        parallel_for(blocks, threads, [&](std::size_t b) {
+          render_buffer_type buffer;
+
+          for (auto i = b * block; i < std::min(texts.size(), (b + 1) * block); ++i)
+          {
+            render_event event = {};
+
+            this->render_rows(texts[i], buffer, event, [&] { return this->load_fig_chs(texts[i], glyphs, buffer); });
+
+            // measured size is the rendered size
+            if (buffer.fig_str.joined_size() != offsets[i + 1] - offsets[i])
+            {
+              throw std::logic_error("Measured size not match the render");
+            }
+
+            // rows with new line
+            this->assemble(event, nullptr, [&] {
+              auto out = arena.data() + offsets[i];
+
+              for (const auto &fig : buffer.fig_str)
+              {
+                traits_type::copy(out, fig.data(), fig.size());
+                out += fig.size();
+                *out++ = traits_type::to_char_type('\n');
+              }
+            });
+          }
+        });
+
+        return true;
+      }
+
+      /**
+       * @brief Split the document to lines, carriage return at the end of a
+       * line is ignored
+       */
+      static std::vector<string_view_type> split_lines(string_view_type doc)
+      {
+        // lines of the document
+        std::vector<string_view_type> lines;
+
+        for (size_type pos = 0; pos < doc.size();)
+        {
+          auto end = doc.find(traits_type::to_char_type('\n'), pos);
+          end = end == string_view_type::npos ? doc.size() : end;
+
+          auto line = doc.substr(pos, end - pos);
+
+          if (!line.empty() && line.back() == '\r')
+          {
+            line.remove_suffix(1);
+          }
+
+          lines.push_back(line);
+          pos = end + 1;
+        }
+
+        return lines;
       }
 
     public:                                                             // Public members
@@ -83,8 +575,13 @@ namespace srilakshmikanthanp
 
       /**
        * @brief Construct a new basic figlet object
+       *
+       * @param font font of the figlet
+       * @param style style of the figlet
+       * @param instrument instrument of the renders
        */
-      basic_figlet(base_figlet_font_ptr font, base_figlet_style_ptr style)
+      basic_figlet(base_figlet_font_ptr font, base_figlet_style_ptr style, instrument_type_t instrument = instrument_type_t())
+        : instrument(std::move(instrument))
       {
         this->set_font_and_style(font, style);
       }
@@ -122,36 +619,428 @@ namespace srilakshmikanthanp
       }
 
       /**
-       * @brief Get the figlet string
+       * @brief Set what to do with characters the font has no fig char for
+       *
+       * @param policy missing glyph policy
+       * @param fallback code point of the fig char to substitute
        */
-      string_type operator()(const string_type &str) const
+      void set_missing_glyph(missing_glyph_type policy, char32_t fallback = 0)
       {
-        // Attributes for Transform
-        std::vector<fig_char_type> fig_chs;
-        const auto hard_blank = this->font->get_hard_blank();
-        const auto height = this->font->get_height();
+        this->missing_glyph = policy;
+        this->fallback_code = fallback;
+        this->has_fallback = this->font->find_code_view(fallback, this->fallback);
+      }
 
-        // Transform to fig char
-        std::transform(
-          str.begin(), str.end(), std::back_inserter(fig_chs),
-          [this](auto ch){
-            return this->font->get_fig_char(ch);
+      /**
+       * @brief Get the missing glyph policy
+       */
+      missing_glyph_type get_missing_glyph() const
+      {
+        return this->missing_glyph;
+      }
+
+      /**
+       * @brief Get the code point of the fig char substituted for a missing one
+       */
+      char32_t get_fallback() const
+      {
+        return this->fallback_code;
+      }
+
+      /**
+       * @brief Get the instrument of the renders
+       */
+      const instrument_type_t &get_instrument() const
+      {
+        return this->instrument;
+      }
+
+      /**
+       * @brief Render the text with the buffers of the caller
+       *
+       * @param str text to render
+       * @param buffer buffers of the render, reused across the calls
+       * @return rows of the figlet string in the buffer
+       */
+      const fig_grid_type &render(string_view_type str, render_buffer_type &buffer) const
+      {
+        render_event event = {};
+
+        // Transform to fig char and render the figlet string
+        this->render_text(str, buffer, event);
+
+        // rows are the output
+        this->record(event);
+
+        // return
+        return buffer.fig_str;
+      }
+
+      /**
+       * @brief Render the text with the buffers of the caller, a missing fig
+       * char is reported to the error code instead of thrown
+       *
+       * @param str text to render
+       * @param buffer buffers of the render, reused across the calls
+       * @param ec invalid_argument if the render fails with the missing glyph policy
+       * @return rows of the figlet string in the buffer (empty on error)
+       */
+      const fig_grid_type &render(string_view_type str, render_buffer_type &buffer, std::error_code &ec) const
+      {
+        render_event event = {};
+
+        // Transform to fig char and render the figlet string
+        if (char32_t code = 0; !this->render_rows(str, buffer, event, [&] { return this->load_fig_chs(str, buffer, code); }))
+        {
+          this->record(event);
+          ec = std::make_error_code(std::errc::invalid_argument);
+          buffer.fig_str.clear();
+          return buffer.fig_str;
+        }
+
+        // rows are the output
+        this->record(event);
+        ec.clear();
+
+        // return
+        return buffer.fig_str;
+      }
+
+      /**
+       * @brief Render the figlet string to the output iterator
+       *
+       * @details the buffers of the render are kept per thread, so a render
+       * does not allocate once they have grown to the size of the text.
+       */
+      template <class output_iterator_type>
+      output_iterator_type render_to(string_view_type str, output_iterator_type out) const
+      {
+        // buffers of the thread
+        static thread_local render_buffer_type buffer;
+
+        // rows of the figlet string
+        render_event event = {};
+        this->render_text(str, buffer, event);
+
+        // rows with new line
+        this->assemble(event, nullptr, [&] {
+          for (const auto &fig : buffer.fig_str)
+          {
+            out = std::copy(fig.begin(), fig.end(), out);
+            *out++ = traits_type::to_char_type('\n');
           }
-        );
+        });
 
-        // Get the figlet string
-        const auto fig_str = this->style->get_fig_str(fig_chs);
+        return out;
+      }
 
-        // add with new line
-        string_type value;
+      /**
+       * @brief Render the figlet string into the string (capacity is reused)
+       *
+       * @details the rows are joined in place in the grid of the render and
+       * copied once to the string, both keep their storage for the next render
+       */
+      void render_into(string_view_type str, string_type &value) const
+      {
+        // buffers of the thread
+        static thread_local render_buffer_type buffer;
+
+        // rows of the figlet string
+        render_event event = {};
+        this->render_text(str, buffer, event);
+
+        // rows joined in the grid
+        this->assemble(event, &value, [&] { value.assign(buffer.fig_str.join()); });
+      }
+
+      /**
+       * @brief Render the figlet string into the string, a missing fig char
+       * is reported to the error code instead of thrown (value is empty then)
+       */
+      void render_into(string_view_type str, string_type &value, std::error_code &ec) const
+      {
+        // buffers of the thread
+        static thread_local render_buffer_type buffer;
+
+        // rows of the figlet string
+        render_event event = {};
 
-        for (const auto &fig : fig_str)
+        if (char32_t code = 0; !this->render_rows(str, buffer, event, [&] { return this->load_fig_chs(str, buffer, code); }))
         {
-          value += fig + traits_type::to_char_type('\n');
+          this->record(event);
+          ec = std::make_error_code(std::errc::invalid_argument);
+          value.clear();
+          return;
         }
 
+        // rows joined in the grid
+        ec.clear();
+        this->assemble(event, &value, [&] { value.assign(buffer.fig_str.join()); });
+      }
+
+      /**
+       * @brief Render the figlet string into the string with the buffers of
+       * the caller
+       *
+       * @details with a std::pmr string type the buffer and the value made
+       * with a memory resource (a monotonic buffer of a request for one)
+       * take every allocation of the render from it, the buffers of the
+       * thread are used by the other renders and allocate from the default
+       * resource.
+       *
+       * @param str text to render
+       * @param value figlet string, the grid is swapped into it when both
+       * have the same allocator
+       * @param buffer buffers of the render
+       */
+      void render_into(string_view_type str, string_type &value, render_buffer_type &buffer) const
+      {
+        // rows of the figlet string
+        render_event event = {};
+        this->render_text(str, buffer, event);
+
+        // grid of the rows is the figlet string (counted in the render when swapped)
+        const auto output = buffer.get_allocator() == value.get_allocator() ? nullptr : &value;
+        this->assemble(event, output, [&] { buffer.fig_str.join(value); });
+      }
+
+      /**
+       * @brief Measure the text with the buffers of the caller
+       *
+       * @details same size as the render but the rows are not built, only
+       * the width of each row is tracked
+       *
+       * @param str text to measure
+       * @param buffer buffers of the measure, reused across the calls
+       * @return width (longest row) and height of the figlet string
+       */
+      fig_size_type measure(string_view_type str, render_buffer_type &buffer) const
+      {
+        // Transform to fig char
+        if (char32_t code = 0; !this->load_fig_chs(str, buffer, code))
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+
+        // measure the figlet string
+        return {this->style->measure_fig_str(this->params, buffer), this->font->get_height()};
+      }
+
+      /**
+       * @brief Measure the text with the buffers of the caller, a missing fig
+       * char is reported to the error code instead of thrown
+       *
+       * @param ec invalid_argument if the measure fails with the missing glyph policy
+       * @return width and height of the figlet string (zero on error)
+       */
+      fig_size_type measure(string_view_type str, render_buffer_type &buffer, std::error_code &ec) const
+      {
+        // Transform to fig char
+        if (char32_t code = 0; !this->load_fig_chs(str, buffer, code))
+        {
+          ec = std::make_error_code(std::errc::invalid_argument);
+          return {0, 0};
+        }
+
+        // measure the figlet string
+        ec.clear();
+        return {this->style->measure_fig_str(this->params, buffer), this->font->get_height()};
+      }
+
+      /**
+       * @brief Measure the text
+       */
+      fig_size_type measure(string_view_type str) const
+      {
+        // buffers of the thread
+        static thread_local render_buffer_type buffer;
+
+        // return
+        return this->measure(str, buffer);
+      }
+
+      /**
+       * @brief Measure the text, a missing fig char is reported to the error
+       * code instead of thrown
+       */
+      fig_size_type measure(string_view_type str, std::error_code &ec) const
+      {
+        // buffers of the thread
+        static thread_local render_buffer_type buffer;
+
+        // return
+        return this->measure(str, buffer, ec);
+      }
+
+      /**
+       * @brief Render every line of the document into the string in parallel
+       *
+       * @details lines are rendered like a batch, carriage return at the end
+       * of a line is ignored.
+       *
+       * @param doc document to render
+       * @param value string to render into (capacity is reused)
+       * @param threads number of threads (0 is the hardware concurrency)
+       */
+      void render_document(string_view_type doc, string_type &value, std::size_t threads = 0) const
+      {
+        // offset of each FIGline in the string
+        std::vector<size_type> offsets;
+
+        // render
+        if (char32_t code = 0; !this->render_all(split_lines(doc), value, offsets, threads, code))
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+      }
+
+      /**
+       * @brief Render every line of the document into the string in parallel,
+       * a missing fig char is reported to the error code instead of thrown
+       *
+       * @param ec invalid_argument if a line fails with the missing glyph
+       * policy (value is empty then)
+       */
+      void render_document(string_view_type doc, string_type &value, std::size_t threads, std::error_code &ec) const
+      {
+        // offset of each FIGline in the string
+        std::vector<size_type> offsets;
+
+        // render
+        if (char32_t code = 0; !this->render_all(split_lines(doc), value, offsets, threads, code))
+        {
+          ec = std::make_error_code(std::errc::invalid_argument);
+          return;
+        }
+
+        ec.clear();
+      }
+
+      /**
+       * @brief Render the texts into one contiguous arena of the batch
+       *
+       * @details the fig chars of printable ascii are looked up once for the
+       * batch, the texts are rendered in blocks of 64 and the blocks are
+       * split across the threads when there is more than one.
+       *
+       * @param texts texts to render
+       * @param batch batch to render into (capacity is reused)
+       * @param threads number of threads (0 is the hardware concurrency)
+       */
+      void render_batch(const std::vector<string_view_type> &texts, render_batch_type &batch, std::size_t threads = 0) const
+      {
+        if (char32_t code = 0; !this->render_all(texts, batch.arena, batch.offsets, threads, code))
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+      }
+
+      /**
+       * @brief Render the texts into one contiguous arena of the batch, a
+       * missing fig char is reported to the error code instead of thrown
+       *
+       * @param ec invalid_argument if a text fails with the missing glyph
+       * policy (batch is empty then)
+       */
+      void render_batch(const std::vector<string_view_type> &texts, render_batch_type &batch, std::size_t threads, std::error_code &ec) const
+      {
+        if (char32_t code = 0; !this->render_all(texts, batch.arena, batch.offsets, threads, code))
+        {
+          ec = std::make_error_code(std::errc::invalid_argument);
+          return;
+        }
+
+        ec.clear();
+      }
+
+      /**
+       * @brief Render the texts into one contiguous arena
+       */
+      render_batch_type render_batch(const std::vector<string_view_type> &texts, std::size_t threads = 0) const
+      {
+        render_batch_type batch;
+        this->render_batch(texts, batch, threads);
+        return batch;
+      }
+
+      /**
+       * @brief Render every line of the document in parallel
+       */
+      string_type render_document(string_view_type doc, std::size_t threads = 0) const
+      {
+        string_type value;
+        this->render_document(doc, value, threads);
+        return value;
+      }
+
+      /**
+       * @brief Get the figlet string
+       *
+       * @details the grid of the render becomes the returned string without
+       * a copy, the buffers are not the ones of render_into so its grid is
+       * never taken away
+       */
+      string_type operator()(const string_type &str) const
+      {
+        // buffers of the thread
+        static thread_local render_buffer_type buffer;
+
+        // rows of the figlet string
+        render_event event = {};
+        this->render_text(str, buffer, event);
+
+        // grid of the rows is the figlet string
+        string_type value;
+        this->assemble(event, nullptr, [&] { buffer.fig_str.join(value); });
+
         return value;
       }
+
+    public:                                                             // static methods
+      /**
+       * @brief Measure the text with each of the fonts
+       *
+       * @details a font that cannot render the text is not an error of the
+       * call, its size is empty so the fonts that fit can still be picked
+       *
+       * @param fonts fonts to measure the text with
+       * @param style style of the figlet
+       * @param str text to measure
+       * @return size of the figlet string of each font, empty if the shrink
+       * level of the font is less than the style or a fig char is missing
+       */
+      static std::vector<std::optional<fig_size_type>> measure(const std::vector<base_figlet_font_ptr> &fonts, base_figlet_style_ptr style, string_view_type str)
+      {
+        // buffers of the measures
+        render_buffer_type buffer;
+
+        // sizes of the fonts
+        std::vector<std::optional<fig_size_type>> sizes;
+        sizes.reserve(fonts.size());
+
+        for (const auto &font : fonts)
+        {
+          // font cannot take the style
+          if (font->get_shrink_level() < style->get_shrink_level())
+          {
+            sizes.emplace_back();
+            continue;
+          }
+
+          // fig chars of the font
+          const basic_figlet figlet(font, style);
+
+          if (char32_t code = 0; !figlet.load_fig_chs(str, buffer, code))
+          {
+            sizes.emplace_back();
+            continue;
+          }
+
+          sizes.emplace_back(fig_size_type{style->measure_fig_str(figlet.params, buffer), font->get_height()});
+        }
+
+        return sizes;
+      }
     };
   } // namespace libfiglet
 } // namespace srilakshmikanthanp
@@ -0,0 +1,571 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Header Guard
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_COMPILED_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_COMPILED_HPP
+
+#include "../abstract/abstract.hpp"
+#include "../types/types.hpp"
+#include "./fonts.hpp"
+
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Header of the compiled font file
+     *
+     * @details The header is followed by the row table (fig_row_type for
+     * each row of each fig char from first_char to last_char and then of
+     * each of the code_count fig chars after them), the code points of the
+     * code_count fig chars in increasing order (std::uint32_t each) and then
+     * glyph_count characters of glyph buffer, all in native byte order.
+     */
+    struct compiled_font_header
+    {
+      char magic[4];                // "FIGC"
+      std::uint32_t byte_order;     // 1 in the native byte order
+      std::uint32_t version;        // format version
+      std::uint32_t char_size;      // sizeof character type
+      std::uint32_t hard_blank;     // hard blank character
+      std::uint32_t height;         // height of the font
+      std::int32_t shrink;          // shrink level of the font
+      std::uint32_t layout;         // horizontal layout of the font
+      std::uint32_t first_char;     // first fig char
+      std::uint32_t last_char;      // last fig char
+      std::uint32_t glyph_count;    // characters in glyph buffer
+      std::uint32_t code_count;     // fig chars of code points outside the range
+    };
+
+    /**
+     * @brief Read only memory mapped file
+     */
+    class mapped_file
+    {
+    private:                                                              // Private members
+      const unsigned char *data = nullptr;                                // mapped data
+      std::size_t length = 0;                                             // mapped length
+
+    public:                                                               // Public constructors
+      mapped_file() = delete;                                             // default constructor
+      mapped_file(const mapped_file &) = delete;                          // copy constructor
+      mapped_file &operator=(const mapped_file &) = delete;               // copy assignment
+
+      /**
+       * @brief Map the file
+       */
+      explicit mapped_file(const std::string &file)
+      {
+#ifdef _WIN32
+        // open the file
+        const auto handle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        // check
+        if (handle == INVALID_HANDLE_VALUE)
+        {
+          throw std::runtime_error("Cannot open font : " + file);
+        }
+
+        // file size
+        LARGE_INTEGER size;
+
+        // check
+        if (!GetFileSizeEx(handle, &size) || size.QuadPart == 0)
+        {
+          CloseHandle(handle);
+          throw std::runtime_error("Invalid compiled font : " + file);
+        }
+
+        // create mapping
+        const auto mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        // map the view
+        const auto view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+        // the view keeps the mapping alive
+        if (mapping)
+        {
+          CloseHandle(mapping);
+        }
+
+        CloseHandle(handle);
+
+        // check
+        if (view == nullptr)
+        {
+          throw std::runtime_error("Cannot map font : " + file);
+        }
+
+        this->data = static_cast<const unsigned char *>(view);
+        this->length = static_cast<std::size_t>(size.QuadPart);
+#else
+        // open the file
+        const auto fd = ::open(file.c_str(), O_RDONLY);
+
+        // check
+        if (fd < 0)
+        {
+          throw std::runtime_error("Cannot open font : " + file);
+        }
+
+        // file stat
+        struct stat st;
+
+        // check
+        if (::fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+          ::close(fd);
+          throw std::runtime_error("Invalid compiled font : " + file);
+        }
+
+        // map the file
+        const auto view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // the mapping keeps the file alive
+        ::close(fd);
+
+        // check
+        if (view == MAP_FAILED)
+        {
+          throw std::runtime_error("Cannot map font : " + file);
+        }
+
+        this->data = static_cast<const unsigned char *>(view);
+        this->length = static_cast<std::size_t>(st.st_size);
+#endif
+      }
+
+      /**
+       * @brief Unmap the file
+       */
+      ~mapped_file()
+      {
+#ifdef _WIN32
+        UnmapViewOfFile(this->data);
+#else
+        ::munmap(const_cast<unsigned char *>(this->data), this->length);
+#endif
+      }
+
+    public:                                                               // Public methods
+      /**
+       * @brief Get the mapped data
+       */
+      const unsigned char *get_data() const
+      {
+        return this->data;
+      }
+
+      /**
+       * @brief Get the mapped length
+       */
+      std::size_t get_length() const
+      {
+        return this->length;
+      }
+    };
+
+    /**
+     * @brief Figlet compiled Font Type, glyphs are served from the mapped file
+     */
+    template <class string_type_t>
+    class basic_compiled_font : public basic_base_figlet_font<string_type_t>
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+
+      using fig_char_type    =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type     =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;        // Figlet char view
+
+    public:                                                               // Public constants
+      static constexpr std::uint32_t version = 4;                         // format version
+
+    private:                                                              // Private members
+      mapped_file file;                                                   // mapped file
+      compiled_font_header header;                                        // header of the font
+      const fig_row_type *rows;                                           // row table of fig chars
+      const std::uint32_t *codes;                                         // code points outside the range, sorted
+      const char_type *glyphs;                                            // rows of all fig chars
+
+    private:                                                              // Private utilities
+      /**
+       * @brief Validate the mapped file and locate the tables
+       */
+      void init(const std::string &path)
+      {
+        // mapped data
+        const auto data = this->file.get_data();
+        const auto length = this->file.get_length();
+
+        // check header size
+        if (length < sizeof(compiled_font_header))
+        {
+          throw std::runtime_error("Invalid compiled font : " + path);
+        }
+
+        // copy the header
+        std::memcpy(&this->header, data, sizeof(compiled_font_header));
+
+        // check magic
+        if (std::memcmp(this->header.magic, "FIGC", 4) != 0 || this->header.byte_order != 1)
+        {
+          throw std::runtime_error("Invalid compiled font : " + path);
+        }
+
+        // check version
+        if (this->header.version != version)
+        {
+          throw std::runtime_error("Unsupported compiled font version : " + path);
+        }
+
+        // check character type
+        if (this->header.char_size != sizeof(char_type))
+        {
+          throw std::runtime_error("Compiled font character size not match : " + path);
+        }
+
+        // check range, height and shrink level
+        if (this->header.first_char > this->header.last_char || this->header.height == 0
+            || this->header.shrink < static_cast<std::int32_t>(shrink_type::FULL_WIDTH) || this->header.shrink > static_cast<std::int32_t>(shrink_type::SMUSHED))
+        {
+          throw std::runtime_error("Invalid compiled font : " + path);
+        }
+
+        // rows the file can hold
+        const std::uint64_t max_rows = (length - sizeof(compiled_font_header)) / sizeof(fig_row_type);
+
+        // fig chars of the range and of the codes (in 64 bits, the range may be all the 32 bit codes)
+        const auto char_count = std::uint64_t(this->header.last_char) - this->header.first_char + 1 + this->header.code_count;
+
+        // check the row table fits the file before the multiplication
+        if (char_count > max_rows || this->header.height > max_rows / char_count)
+        {
+          throw std::runtime_error("Invalid compiled font : " + path);
+        }
+
+        // size of the tables
+        const auto row_count = char_count * this->header.height;
+        const auto rows_size = row_count * sizeof(fig_row_type);
+        const auto codes_size = std::uint64_t(this->header.code_count) * sizeof(std::uint32_t);
+        const auto glyph_size = std::uint64_t(this->header.glyph_count) * sizeof(char_type);
+
+        // check size
+        if (sizeof(compiled_font_header) + rows_size + codes_size + glyph_size != length)
+        {
+          throw std::runtime_error("Invalid compiled font : " + path);
+        }
+
+        // locate the tables
+        this->rows = reinterpret_cast<const fig_row_type *>(data + sizeof(compiled_font_header));
+        this->codes = reinterpret_cast<const std::uint32_t *>(data + sizeof(compiled_font_header) + rows_size);
+        this->glyphs = reinterpret_cast<const char_type *>(data + sizeof(compiled_font_header) + rows_size + codes_size);
+
+        // check codes are sorted and outside the range
+        for (std::uint32_t i = 0; i < this->header.code_count; ++i)
+        {
+          if ((i > 0 && this->codes[i] <= this->codes[i - 1]) || (this->codes[i] >= this->header.first_char && this->codes[i] <= this->header.last_char))
+          {
+            throw std::runtime_error("Invalid compiled font : " + path);
+          }
+        }
+
+        // check rows are in the buffer
+        for (std::uint64_t i = 0; i < row_count; ++i)
+        {
+          if (std::uint64_t(this->rows[i].offset) + this->rows[i].width > this->header.glyph_count
+              || this->rows[i].lead > this->rows[i].width || this->rows[i].trail > this->rows[i].width)
+          {
+            throw std::runtime_error("Invalid compiled font : " + path);
+          }
+        }
+      }
+
+    public:                                                               // Public constructors
+      basic_compiled_font() = delete;                                     // default constructor
+      basic_compiled_font(const basic_compiled_font &) = delete;          // copy constructor
+
+      /**
+       * @brief From compiled font file
+       */
+      explicit basic_compiled_font(const std::string &file) : file(file)
+      {
+        this->init(file);
+      }
+
+    public: // Public overrides
+      /**
+       * @brief Get the Hard Blank character
+       */
+      char_type get_hard_blank() const override
+      {
+        return traits_type::to_char_type(static_cast<typename traits_type::int_type>(this->header.hard_blank));
+      }
+
+      /**
+       * @brief Get the height of the font
+       */
+      size_type get_height() const override
+      {
+        return this->header.height;
+      }
+
+      /**
+       * @brief Get the shrink level
+       */
+      shrink_type get_shrink_level() const override
+      {
+        return static_cast<shrink_type>(this->header.shrink);
+      }
+
+      /**
+       * @brief Get the horizontal layout
+       */
+      layout_type get_layout() const override
+      {
+        return this->header.layout;
+      }
+
+      /**
+       * @brief Get the fig char as view to the mapped file
+       */
+      fig_char_view_type get_fig_char_view(char_type ch) const override
+      {
+        return this->get_code_view(to_code(ch));
+      }
+
+      /**
+       * @brief Get the fig char of the code point as view to the mapped file
+       */
+      fig_char_view_type get_code_view(char32_t code) const override
+      {
+        // fig char view
+        fig_char_view_type view;
+
+        // check
+        if (!this->find_code_view(code, view))
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+
+        // return
+        return view;
+      }
+
+      /**
+       * @brief Find the fig char of the code point without throwing
+       */
+      bool find_code_view(char32_t code, fig_char_view_type &view) const override
+      {
+        // fig chars of the range
+        const auto range = std::size_t(this->header.last_char - this->header.first_char) + 1;
+
+        // index of the fig char
+        std::size_t index;
+
+        if (code >= this->header.first_char && code <= this->header.last_char)
+        {
+          index = code - this->header.first_char;
+        }
+        else
+        {
+          const auto end = this->codes + this->header.code_count;
+          const auto itr = std::lower_bound(this->codes, end, static_cast<std::uint32_t>(code));
+
+          if (itr == end || *itr != code)
+          {
+            return false;
+          }
+
+          index = range + std::size_t(itr - this->codes);
+        }
+
+        // set the view
+        view = fig_char_view_type(this->glyphs, this->rows + index * this->header.height, this->header.height);
+
+        // return
+        return true;
+      }
+
+      /**
+       * @brief Get the code points of the fig chars of the font
+       */
+      std::vector<char32_t> get_code_points() const override
+      {
+        std::vector<char32_t> code_points(this->codes, this->codes + this->header.code_count);
+
+        for (auto code = std::uint64_t(this->header.first_char); code <= this->header.last_char; ++code)
+        {
+          code_points.push_back(static_cast<char32_t>(code));
+        }
+
+        std::sort(code_points.begin(), code_points.end());
+
+        return code_points;
+      }
+
+    public: // static methods
+      /**
+       * @brief Write the font as compiled font file
+       */
+      static void compile(const basic_base_figlet_font<string_type> &font, const std::string &file)
+      {
+        // first and last fig char
+        const char_type first_char = ' ', last_char = '~';
+
+        // tables
+        std::vector<fig_row_type> rows;
+        std::vector<std::uint32_t> codes;
+        string_type glyphs;
+
+        // copy rows of the fig char
+        const auto add_rows = [&](const fig_char_view_type &view) {
+          for (size_type i = 0; i < font.get_height(); ++i)
+          {
+            rows.push_back(make_fig_row(static_cast<std::uint32_t>(glyphs.size()), view[i]));
+            glyphs += view[i];
+          }
+        };
+
+        // fig chars of the range
+        for (char_type ch = first_char; ch <= last_char; ++ch)
+        {
+          add_rows(font.get_fig_char_view(ch));
+        }
+
+        // fig chars of the other code points (Deutsch and code tagged)
+        for (const auto code : font.get_code_points())
+        {
+          if (code < to_code(first_char) || code > to_code(last_char))
+          {
+            add_rows(font.get_code_view(code));
+            codes.push_back(static_cast<std::uint32_t>(code));
+          }
+        }
+
+        // check buffer limit
+        if (glyphs.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+          throw std::runtime_error("Font too large");
+        }
+
+        // header of the font
+        compiled_font_header header = {
+          {'F', 'I', 'G', 'C'},
+          1,
+          version,
+          static_cast<std::uint32_t>(sizeof(char_type)),
+          static_cast<std::uint32_t>(traits_type::to_int_type(font.get_hard_blank())),
+          static_cast<std::uint32_t>(font.get_height()),
+          static_cast<std::int32_t>(font.get_shrink_level()),
+          static_cast<std::uint32_t>(font.get_layout()),
+          static_cast<std::uint32_t>(traits_type::to_int_type(first_char)),
+          static_cast<std::uint32_t>(traits_type::to_int_type(last_char)),
+          static_cast<std::uint32_t>(glyphs.size()),
+          static_cast<std::uint32_t>(codes.size())
+        };
+
+        // output file
+        std::ofstream ofs(file, std::ios::binary);
+
+        // check
+        if (!ofs.is_open())
+        {
+          throw std::runtime_error("Cannot open file : " + file);
+        }
+
+        // write
+        ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        ofs.write(reinterpret_cast<const char *>(rows.data()), rows.size() * sizeof(fig_row_type));
+        ofs.write(reinterpret_cast<const char *>(codes.data()), codes.size() * sizeof(std::uint32_t));
+        ofs.write(reinterpret_cast<const char *>(glyphs.data()), glyphs.size() * sizeof(char_type));
+
+        // check
+        if (!ofs)
+        {
+          throw std::runtime_error("Cannot write file : " + file);
+        }
+      }
+
+      /**
+       * @brief Make a compiled font type as shared pointer
+       */
+      static auto make_shared(const std::string &file)
+      {
+        return std::make_shared<basic_compiled_font>(file);
+      }
+    };
+
+    /**
+     * @brief Compile every flf font in the directory to the output directory
+     *
+     * @param src_dir directory with flf fonts
+     * @param dst_dir directory for the compiled fonts (same name with .flfc)
+     * @return std::vector<std::string> fonts that could not be compiled
+     */
+    template <class string_type_t>
+    std::vector<std::string> compile_flf_fonts(const std::string &src_dir, const std::string &dst_dir)
+    {
+      // fonts that are not compiled
+      std::vector<std::string> failed;
+
+      // create the output directory
+      std::filesystem::create_directories(dst_dir);
+
+      for (const auto &entry : std::filesystem::directory_iterator(src_dir))
+      {
+        // only flf fonts
+        if (entry.path().extension() != ".flf")
+        {
+          continue;
+        }
+
+        // output path
+        auto dst = std::filesystem::path(dst_dir) / entry.path().filename();
+
+        try
+        {
+          basic_compiled_font<string_type_t>::compile(basic_flf_font<string_type_t>(entry.path().string()), dst.replace_extension(".flfc").string());
+        }
+        catch(const std::exception&)
+        {
+          failed.push_back(entry.path().string());
+        }
+      }
+
+      return failed;
+    }
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_COMPILED_HPP
@@ -0,0 +1,377 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Header Guard
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_HPP
+
+#include "../abstract/abstract.hpp"
+#include "../types/types.hpp"
+
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Convert the embedded glyph codes to characters at compile time
+     */
+    template <class char_type_t, std::size_t N>
+    constexpr std::array<char_type_t, N> make_embedded_glyphs(const std::uint32_t (&codes)[N])
+    {
+      std::array<char_type_t, N> glyphs{};
+
+      for (std::size_t i = 0; i < N; ++i)
+      {
+        glyphs[i] = static_cast<char_type_t>(codes[i]);
+      }
+
+      return glyphs;
+    }
+
+    /**
+     * @brief Figlet embedded Font Type, glyphs are constexpr tables of the font data
+     *
+     * @details font_data_t is generated by write_embedded_font and has the
+     * static constexpr members hard_blank, height, shrink, layout, rows (with
+     * the edge spaces of each row) and glyphs (character codes of the glyph
+     * buffer).
+     */
+    template <class string_type_t, class font_data_t>
+    class basic_embedded_font : public basic_base_figlet_font<string_type_t>
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+
+      using fig_char_type    =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type     =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;        // Figlet char view
+
+      using font_data_type   =   font_data_t;                             // Font Data Type
+
+    private:                                                              // Private constants
+      static constexpr char_type first_char = ' ';                        // first fig char
+      static constexpr char_type last_char  = '~';                        // last fig char
+
+      static constexpr std::size_t height = font_data_t::height;          // height of the font
+      static constexpr std::size_t glyph_count = std::size(font_data_t::glyphs);
+
+    public:                                                               // Public constants
+      static constexpr std::array<char_type, glyph_count> glyphs = make_embedded_glyphs<char_type>(font_data_t::glyphs);
+
+    private:                                                              // Private utilities
+      /**
+       * @brief Get the fig char view at compile time
+       */
+      static constexpr fig_char_view_type fig_char_view(char_type ch)
+      {
+        // check
+        if (ch < first_char || ch > last_char)
+        {
+          throw std::runtime_error("Invalid character");
+        }
+
+        // return
+        return fig_char_view_type(glyphs.data(), font_data_t::rows + (ch - first_char) * height, height);
+      }
+
+      /**
+       * @brief Layout the text with full width or kerning at compile time
+       *
+       * @details simulates the style on every row of the text and writes the
+       * rows separated by new line to out when it is not null.
+       *
+       * @return std::size_t size of the output
+       */
+      template <std::size_t N>
+      static constexpr std::size_t layout(const char_type (&text)[N], shrink_type shrink, char_type *out, std::size_t size)
+      {
+        // length of the text without null
+        constexpr std::size_t length = N - 1;
+
+        // overlap of each fig char
+        std::array<std::size_t, N> amounts{};
+
+        // length and trailing spaces of each row
+        std::array<std::size_t, height> lens{}, trails{};
+
+        // output size
+        std::size_t total = 0;
+
+        // find the overlap of each fig char
+        for (std::size_t k = 0; k < length; ++k)
+        {
+          const auto view = fig_char_view(text[k]);
+
+          // minimum of right spaces and left spaces
+          std::size_t amount = shrink == shrink_type::FULL_WIDTH ? 0 : std::size_t(-1);
+
+          for (std::size_t r = 0; r < height && amount != 0; ++r)
+          {
+            amount = trails[r] + view.lead(r) < amount ? trails[r] + view.lead(r) : amount;
+          }
+
+          amounts[k] = amount;
+
+          // add the fig char
+          for (std::size_t r = 0; r < height; ++r)
+          {
+            const auto row = view[r];
+            const auto pop = amount < trails[r] ? amount : trails[r];
+            const auto skip = amount - pop < row.size() ? amount - pop : row.size();
+
+            lens[r] = lens[r] - pop + row.size() - skip;
+            trails[r] = view.trail(r) == row.size() ? trails[r] - pop + row.size() - skip : view.trail(r);
+          }
+        }
+
+        // write the rows
+        for (std::size_t r = 0; r < height; ++r)
+        {
+          std::size_t pos = total, trail = 0;
+
+          for (std::size_t k = 0; k < length && out; ++k)
+          {
+            const auto view = fig_char_view(text[k]);
+            const auto row = view[r];
+            const auto pop = amounts[k] < trail ? amounts[k] : trail;
+            const auto skip = amounts[k] - pop < row.size() ? amounts[k] - pop : row.size();
+
+            pos = pos - pop;
+            trail = view.trail(r) == row.size() ? trail - pop + row.size() - skip : view.trail(r);
+
+            for (std::size_t i = skip; i < row.size(); ++i, ++pos)
+            {
+              if (pos < size)
+              {
+                out[pos] = row[i] == static_cast<char_type>(font_data_t::hard_blank) ? char_type(' ') : row[i];
+              }
+            }
+          }
+
+          // end of the row
+          total += lens[r];
+
+          if (out && total < size)
+          {
+            out[total] = char_type('\n');
+          }
+
+          total += 1;
+        }
+
+        return total;
+      }
+
+    public:                                                               // Public constructors
+      basic_embedded_font() = default;                                    // default constructor
+
+    public: // Public overrides
+      /**
+       * @brief Get the Hard Blank character
+       */
+      char_type get_hard_blank() const override
+      {
+        return static_cast<char_type>(font_data_t::hard_blank);
+      }
+
+      /**
+       * @brief Get the height of the font
+       */
+      size_type get_height() const override
+      {
+        return height;
+      }
+
+      /**
+       * @brief Get the shrink level
+       */
+      shrink_type get_shrink_level() const override
+      {
+        return font_data_t::shrink;
+      }
+
+      /**
+       * @brief Get the horizontal layout
+       */
+      layout_type get_layout() const override
+      {
+        return font_data_t::layout;
+      }
+
+      /**
+       * @brief Get the fig char as view to the embedded tables
+       */
+      fig_char_view_type get_fig_char_view(char_type ch) const override
+      {
+        // check
+        if (ch < first_char || ch > last_char)
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(ch));
+        }
+
+        // return
+        return fig_char_view(ch);
+      }
+
+      /**
+       * @brief Find the fig char of the code point without throwing
+       */
+      bool find_code_view(char32_t code, fig_char_view_type &view) const override
+      {
+        // check
+        if (code < to_code(first_char) || code > to_code(last_char))
+        {
+          return false;
+        }
+
+        // set the view
+        view = fig_char_view(static_cast<char_type>(code));
+
+        // return
+        return true;
+      }
+
+    public: // static methods
+      /**
+       * @brief Size of the text rendered at compile time
+       *
+       * @param text text to render
+       * @param shrink FULL_WIDTH or KERNING
+       */
+      template <std::size_t N>
+      static constexpr std::size_t measure(const char_type (&text)[N], shrink_type shrink)
+      {
+        return layout(text, shrink, nullptr, 0);
+      }
+
+      /**
+       * @brief Render the text at compile time, size must be measure(text, shrink)
+       *
+       * @param text text to render
+       * @param shrink FULL_WIDTH or KERNING
+       */
+      template <std::size_t size, std::size_t N>
+      static constexpr std::array<char_type, size> render(const char_type (&text)[N], shrink_type shrink)
+      {
+        // output container
+        std::array<char_type, size> out{};
+
+        // check
+        if (layout(text, shrink, out.data(), size) != size)
+        {
+          throw std::runtime_error("Size not match");
+        }
+
+        // return
+        return out;
+      }
+
+      /**
+       * @brief Make a embedded font type as shared pointer
+       */
+      static auto make_shared()
+      {
+        return std::make_shared<basic_embedded_font>();
+      }
+    };
+
+    /**
+     * @brief Write the font as embedded font data header
+     *
+     * @param font font to embed
+     * @param name name of the font data struct
+     * @param os stream to write the header
+     */
+    template <class string_type_t>
+    void write_embedded_font(const basic_base_figlet_font<string_type_t> &font, const std::string &name, std::ostream &os)
+    {
+      using char_type   = typename string_type_t::value_type;
+      using traits_type = typename string_type_t::traits_type;
+
+      // header guard
+      std::string guard = "SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_" + name + "_HPP";
+
+      for (auto &ch : guard)
+      {
+        ch = static_cast<char>(std::toupper(static_cast<unsigned char>(ch)));
+      }
+
+      // shrink level
+      const char *shrinks[] = {"FULL_WIDTH", "KERNING", "SMUSHED"};
+
+      os << "// Generated by libfiglet write_embedded_font, do not edit\n\n";
+      os << "#ifndef " << guard << "\n";
+      os << "#define " << guard << "\n\n";
+      os << "#include \"../embedded.hpp\"\n\n";
+      os << "namespace srilakshmikanthanp\n{\n  namespace libfiglet\n  {\n";
+      os << "    struct " << name << "_data\n    {\n";
+      os << "      static constexpr std::uint32_t hard_blank = " << traits_type::to_int_type(font.get_hard_blank()) << ";\n";
+      os << "      static constexpr std::size_t height = " << font.get_height() << ";\n";
+      os << "      static constexpr shrink_type shrink = shrink_type::" << shrinks[static_cast<int>(font.get_shrink_level())] << ";\n";
+      os << "      static constexpr layout_type layout = " << font.get_layout() << ";\n\n";
+
+      // glyph codes
+      std::vector<std::uint32_t> glyphs;
+
+      // row table
+      os << "      static constexpr fig_row_type rows[] = {\n";
+
+      for (char_type ch = ' '; ch <= '~'; ++ch)
+      {
+        const auto view = font.get_fig_char_view(ch);
+
+        os << "       ";
+
+        for (std::size_t i = 0; i < view.size(); ++i)
+        {
+          const auto row = make_fig_row(static_cast<std::uint32_t>(glyphs.size()), view[i]);
+
+          os << " {" << row.offset << ", " << row.width << ", " << row.lead << ", " << row.trail << "},";
+
+          for (const auto c : view[i])
+          {
+            glyphs.push_back(static_cast<std::uint32_t>(traits_type::to_int_type(c)));
+          }
+        }
+
+        os << "\n";
+      }
+
+      os << "      };\n\n";
+
+      // glyphs terminated with null
+      glyphs.push_back(0);
+
+      os << "      static constexpr std::uint32_t glyphs[] = {";
+
+      for (std::size_t i = 0; i < glyphs.size(); ++i)
+      {
+        os << (i % 16 == 0 ? "\n        " : " ") << glyphs[i] << ",";
+      }
+
+      os << "\n      };\n    };\n\n";
+      os << "    using " << name << "  = basic_embedded_font<std::string, " << name << "_data>;\n";
+      os << "    using w" << name << " = basic_embedded_font<std::wstring, " << name << "_data>;\n";
+      os << "  }\n}\n\n";
+      os << "#endif // " << guard << "\n";
+    }
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_HPP
@@ -0,0 +1,381 @@
+// Generated by libfiglet write_embedded_font, do not edit
+
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_STANDARD_FONT_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_STANDARD_FONT_HPP
+
+#include "../embedded.hpp"
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    struct standard_font_data
+    {
+      static constexpr std::uint32_t hard_blank = 36;
+      static constexpr std::size_t height = 6;
+      static constexpr shrink_type shrink = shrink_type::SMUSHED;
+      static constexpr layout_type layout = 143;
+
+      static constexpr fig_row_type rows[] = {
+        {0, 3, 0, 0}, {3, 3, 0, 0}, {6, 3, 0, 0}, {9, 3, 0, 0}, {12, 3, 0, 0}, {15, 3, 0, 0},
+        {18, 4, 2, 1}, {22, 4, 1, 0}, {26, 4, 1, 0}, {30, 4, 1, 0}, {34, 4, 1, 0}, {38, 4, 4, 4},
+        {42, 6, 2, 1}, {48, 6, 1, 0}, {54, 6, 2, 1}, {60, 6, 3, 2}, {66, 6, 3, 2}, {72, 6, 6, 6},
+        {78, 11, 4, 3}, {89, 11, 2, 1}, {100, 11, 1, 0}, {111, 11, 1, 0}, {122, 11, 3, 2}, {133, 11, 11, 11},
+        {144, 6, 3, 2}, {150, 6, 2, 1}, {156, 6, 1, 0}, {162, 6, 1, 0}, {168, 6, 1, 0}, {174, 6, 2, 1},
+        {180, 7, 2, 0}, {187, 7, 1, 0}, {194, 7, 3, 1}, {201, 7, 2, 1}, {208, 7, 1, 0}, {215, 7, 7, 7},
+        {222, 9, 3, 3}, {231, 9, 2, 2}, {240, 9, 2, 0}, {249, 9, 1, 0}, {258, 9, 2, 0}, {267, 9, 9, 9},
+        {276, 4, 2, 1}, {280, 4, 1, 0}, {284, 4, 1, 1}, {288, 4, 2, 1}, {292, 4, 2, 1}, {296, 4, 4, 4},
+        {300, 5, 3, 0}, {305, 5, 2, 0}, {310, 5, 1, 1}, {315, 5, 1, 1}, {320, 5, 1, 1}, {325, 5, 2, 0},
+        {330, 5, 1, 2}, {335, 5, 1, 1}, {340, 5, 2, 0}, {345, 5, 2, 0}, {350, 5, 2, 0}, {355, 5, 1, 1},
+        {360, 7, 7, 7}, {367, 7, 1, 0}, {374, 7, 1, 0}, {381, 7, 1, 0}, {388, 7, 3, 2}, {395, 7, 7, 7},
+        {402, 8, 8, 8}, {410, 8, 4, 3}, {418, 8, 2, 1}, {426, 8, 1, 0}, {434, 8, 3, 2}, {442, 8, 8, 8},
+        {450, 4, 4, 4}, {454, 4, 4, 4}, {458, 4, 4, 4}, {462, 4, 2, 1}, {466, 4, 1, 0}, {470, 4, 1, 1},
+        {474, 8, 8, 8}, {482, 8, 8, 8}, {490, 8, 2, 1}, {498, 8, 1, 0}, {506, 8, 4, 3}, {514, 8, 8, 8},
+        {522, 4, 4, 4}, {526, 4, 4, 4}, {530, 4, 4, 4}, {534, 4, 2, 1}, {538, 4, 1, 0}, {542, 4, 4, 4},
+        {546, 7, 5, 0}, {553, 7, 4, 0}, {560, 7, 3, 1}, {567, 7, 2, 2}, {574, 7, 1, 3}, {581, 7, 7, 7},
+        {588, 8, 3, 2}, {596, 8, 2, 1}, {604, 8, 1, 0}, {612, 8, 1, 0}, {620, 8, 2, 1}, {628, 8, 8, 8},
+        {636, 4, 2, 1}, {640, 4, 1, 0}, {644, 4, 1, 0}, {648, 4, 1, 0}, {652, 4, 1, 0}, {656, 4, 4, 4},
+        {660, 8, 2, 2}, {668, 8, 1, 1}, {676, 8, 3, 0}, {684, 8, 2, 1}, {692, 8, 1, 0}, {700, 8, 8, 8},
+        {708, 8, 2, 1}, {716, 8, 1, 1}, {724, 8, 3, 1}, {732, 8, 2, 0}, {740, 8, 1, 1}, {748, 8, 8, 8},
+        {756, 9, 2, 3}, {765, 9, 1, 2}, {774, 9, 1, 1}, {783, 9, 1, 0}, {792, 9, 4, 2}, {801, 9, 9, 9},
+        {810, 8, 2, 2}, {818, 8, 1, 1}, {826, 8, 1, 1}, {834, 8, 2, 0}, {842, 8, 1, 1}, {850, 8, 8, 8},
+        {858, 8, 3, 3}, {866, 8, 2, 2}, {874, 8, 1, 1}, {882, 8, 1, 0}, {890, 8, 2, 1}, {898, 8, 8, 8},
+        {906, 8, 2, 1}, {914, 8, 1, 0}, {922, 8, 4, 1}, {930, 8, 3, 2}, {938, 8, 2, 3}, {946, 8, 8, 8},
+        {954, 8, 3, 2}, {962, 8, 2, 1}, {970, 8, 2, 1}, {978, 8, 1, 0}, {986, 8, 2, 1}, {994, 8, 8, 8},
+        {1002, 8, 3, 2}, {1010, 8, 2, 1}, {1018, 8, 1, 0}, {1026, 8, 2, 0}, {1034, 8, 4, 1}, {1042, 8, 8, 8},
+        {1050, 4, 4, 4}, {1054, 4, 2, 1}, {1058, 4, 1, 0}, {1062, 4, 2, 1}, {1066, 4, 1, 0}, {1070, 4, 4, 4},
+        {1074, 4, 4, 4}, {1078, 4, 2, 1}, {1082, 4, 1, 0}, {1086, 4, 2, 1}, {1090, 4, 1, 0}, {1094, 4, 1, 1},
+        {1098, 5, 3, 0}, {1103, 5, 2, 0}, {1108, 5, 1, 1}, {1113, 5, 1, 1}, {1118, 5, 2, 0}, {1123, 5, 5, 5},
+        {1128, 8, 8, 8}, {1136, 8, 2, 1}, {1144, 8, 1, 0}, {1152, 8, 1, 0}, {1160, 8, 4, 3}, {1168, 8, 8, 8},
+        {1176, 5, 1, 2}, {1181, 5, 1, 1}, {1186, 5, 2, 0}, {1191, 5, 2, 0}, {1196, 5, 1, 1}, {1201, 5, 5, 5},
+        {1206, 6, 2, 1}, {1212, 6, 1, 0}, {1218, 6, 3, 0}, {1224, 6, 2, 1}, {1230, 6, 2, 1}, {1236, 6, 6, 6},
+        {1242, 10, 4, 2}, {1252, 10, 3, 1}, {1262, 10, 2, 0}, {1272, 10, 1, 0}, {1282, 10, 2, 0}, {1292, 10, 3, 1},
+        {1302, 10, 5, 4}, {1312, 10, 4, 3}, {1322, 10, 3, 2}, {1332, 10, 2, 1}, {1342, 10, 1, 0}, {1352, 10, 10, 10},
+        {1362, 8, 2, 2}, {1370, 8, 1, 1}, {1378, 8, 1, 1}, {1386, 8, 1, 0}, {1394, 8, 1, 1}, {1402, 8, 8, 8},
+        {1410, 8, 3, 1}, {1418, 8, 2, 0}, {1426, 8, 1, 4}, {1434, 8, 1, 1}, {1442, 8, 2, 0}, {1450, 8, 8, 8},
+        {1458, 8, 2, 2}, {1466, 8, 1, 1}, {1474, 8, 1, 0}, {1482, 8, 1, 0}, {1490, 8, 1, 1}, {1498, 8, 8, 8},
+        {1506, 8, 2, 1}, {1514, 8, 1, 0}, {1522, 8, 1, 2}, {1530, 8, 1, 1}, {1538, 8, 1, 0}, {1546, 8, 8, 8},
+        {1554, 8, 2, 1}, {1562, 8, 1, 0}, {1570, 8, 1, 3}, {1578, 8, 1, 2}, {1586, 8, 1, 4}, {1594, 8, 8, 8},
+        {1602, 8, 3, 1}, {1610, 8, 2, 0}, {1618, 8, 1, 1}, {1626, 8, 1, 0}, {1634, 8, 2, 0}, {1642, 8, 8, 8},
+        {1650, 8, 2, 1}, {1658, 8, 1, 0}, {1666, 8, 1, 0}, {1674, 8, 1, 0}, {1682, 8, 1, 0}, {1690, 8, 8, 8},
+        {1698, 6, 2, 1}, {1704, 6, 1, 0}, {1710, 6, 2, 1}, {1716, 6, 2, 1}, {1722, 6, 1, 0}, {1728, 6, 6, 6},
+        {1734, 8, 6, 1}, {1742, 8, 5, 0}, {1750, 8, 2, 0}, {1758, 8, 1, 0}, {1766, 8, 2, 1}, {1774, 8, 8, 8},
+        {1782, 7, 2, 0}, {1789, 7, 1, 0}, {1796, 7, 1, 1}, {1803, 7, 1, 1}, {1810, 7, 1, 0}, {1817, 7, 7, 7},
+        {1824, 8, 2, 5}, {1832, 8, 1, 4}, {1840, 8, 1, 4}, {1848, 8, 1, 1}, {1856, 8, 1, 0}, {1864, 8, 8, 8},
+        {1872, 9, 2, 1}, {1881, 9, 1, 0}, {1890, 9, 1, 0}, {1899, 9, 1, 0}, {1908, 9, 1, 0}, {1917, 9, 9, 9},
+        {1926, 8, 2, 1}, {1934, 8, 1, 0}, {1942, 8, 1, 0}, {1950, 8, 1, 0}, {1958, 8, 1, 0}, {1966, 8, 8, 8},
+        {1974, 8, 3, 2}, {1982, 8, 2, 1}, {1990, 8, 1, 0}, {1998, 8, 1, 0}, {2006, 8, 2, 1}, {2014, 8, 8, 8},
+        {2022, 8, 2, 2}, {2030, 8, 1, 1}, {2038, 8, 1, 0}, {2046, 8, 1, 1}, {2054, 8, 1, 4}, {2062, 8, 8, 8},
+        {2070, 8, 3, 2}, {2078, 8, 2, 1}, {2086, 8, 1, 0}, {2094, 8, 1, 0}, {2102, 8, 2, 0}, {2110, 8, 8, 8},
+        {2118, 8, 2, 2}, {2126, 8, 1, 1}, {2134, 8, 1, 0}, {2142, 8, 1, 1}, {2150, 8, 1, 0}, {2158, 8, 8, 8},
+        {2166, 8, 2, 2}, {2174, 8, 1, 1}, {2182, 8, 1, 1}, {2190, 8, 2, 0}, {2198, 8, 1, 1}, {2206, 8, 8, 8},
+        {2214, 8, 2, 1}, {2222, 8, 1, 0}, {2230, 8, 3, 2}, {2238, 8, 3, 2}, {2246, 8, 3, 2}, {2254, 8, 8, 8},
+        {2262, 8, 2, 1}, {2270, 8, 1, 0}, {2278, 8, 1, 0}, {2286, 8, 1, 0}, {2294, 8, 2, 1}, {2302, 8, 8, 8},
+        {2310, 10, 1, 0}, {2320, 10, 1, 0}, {2330, 10, 2, 1}, {2340, 10, 3, 2}, {2350, 10, 4, 3}, {2360, 10, 10, 10},
+        {2370, 13, 1, 0}, {2383, 13, 1, 0}, {2396, 13, 2, 1}, {2409, 13, 3, 2}, {2422, 13, 4, 3}, {2435, 13, 13, 13},
+        {2448, 7, 1, 0}, {2455, 7, 1, 0}, {2462, 7, 2, 1}, {2469, 7, 2, 1}, {2476, 7, 1, 0}, {2483, 7, 7, 7},
+        {2490, 8, 1, 0}, {2498, 8, 1, 0}, {2506, 8, 2, 1}, {2514, 8, 3, 2}, {2522, 8, 3, 2}, {2530, 8, 8, 8},
+        {2538, 7, 2, 0}, {2545, 7, 1, 0}, {2552, 7, 3, 1}, {2559, 7, 2, 1}, {2566, 7, 1, 0}, {2573, 7, 7, 7},
+        {2580, 5, 2, 1}, {2585, 5, 1, 0}, {2590, 5, 1, 1}, {2595, 5, 1, 1}, {2600, 5, 1, 1}, {2605, 5, 1, 0},
+        {2610, 7, 1, 4}, {2617, 7, 1, 3}, {2624, 7, 2, 2}, {2631, 7, 3, 1}, {2638, 7, 4, 0}, {2645, 7, 7, 7},
+        {2652, 5, 2, 1}, {2657, 5, 1, 0}, {2662, 5, 2, 0}, {2667, 5, 2, 0}, {2672, 5, 2, 0}, {2677, 5, 1, 0},
+        {2682, 5, 2, 1}, {2687, 5, 1, 0}, {2692, 5, 3, 1}, {2697, 5, 3, 1}, {2702, 5, 3, 1}, {2707, 5, 5, 5},
+        {2712, 8, 8, 8}, {2720, 8, 8, 8}, {2728, 8, 8, 8}, {2736, 8, 8, 8}, {2744, 8, 2, 1}, {2752, 8, 1, 0},
+        {2760, 4, 2, 1}, {2764, 4, 1, 0}, {2768, 4, 2, 0}, {2772, 4, 2, 1}, {2776, 4, 2, 1}, {2780, 4, 4, 4},
+        {2784, 8, 8, 8}, {2792, 8, 3, 1}, {2800, 8, 2, 0}, {2808, 8, 1, 0}, {2816, 8, 2, 0}, {2824, 8, 8, 8},
+        {2832, 8, 2, 5}, {2840, 8, 1, 2}, {2848, 8, 1, 1}, {2856, 8, 1, 0}, {2864, 8, 1, 1}, {2872, 8, 8, 8},
+        {2880, 7, 7, 7}, {2887, 7, 3, 1}, {2894, 7, 2, 0}, {2901, 7, 1, 1}, {2908, 7, 2, 0}, {2915, 7, 7, 7},
+        {2922, 8, 6, 1}, {2930, 8, 3, 0}, {2938, 8, 2, 0}, {2946, 8, 1, 0}, {2954, 8, 2, 0}, {2962, 8, 8, 8},
+        {2970, 7, 7, 7}, {2977, 7, 3, 1}, {2984, 7, 2, 0}, {2991, 7, 1, 0}, {2998, 7, 2, 0}, {3005, 7, 7, 7},
+        {3012, 6, 3, 1}, {3018, 6, 2, 0}, {3024, 6, 1, 1}, {3030, 6, 1, 0}, {3036, 6, 1, 2}, {3042, 6, 6, 6},
+        {3048, 8, 8, 8}, {3056, 8, 3, 1}, {3064, 8, 2, 0}, {3072, 8, 1, 0}, {3080, 8, 2, 0}, {3088, 8, 2, 1},
+        {3096, 8, 2, 5}, {3104, 8, 1, 2}, {3112, 8, 1, 1}, {3120, 8, 1, 0}, {3128, 8, 1, 0}, {3136, 8, 8, 8},
+        {3144, 4, 2, 1}, {3148, 4, 1, 0}, {3152, 4, 1, 0}, {3156, 4, 1, 0}, {3160, 4, 1, 0}, {3164, 4, 4, 4},
+        {3168, 6, 4, 1}, {3174, 6, 3, 0}, {3180, 6, 3, 0}, {3186, 6, 3, 0}, {3192, 6, 2, 0}, {3198, 6, 1, 1},
+        {3204, 7, 2, 4}, {3211, 7, 1, 0}, {3218, 7, 1, 0}, {3225, 7, 1, 1}, {3232, 7, 1, 0}, {3239, 7, 7, 7},
+        {3246, 4, 2, 1}, {3250, 4, 1, 0}, {3254, 4, 1, 0}, {3258, 4, 1, 0}, {3262, 4, 1, 0}, {3266, 4, 4, 4},
+        {3270, 12, 12, 12}, {3282, 12, 2, 2}, {3294, 12, 1, 1}, {3306, 12, 1, 0}, {3318, 12, 1, 0}, {3330, 12, 12, 12},
+        {3342, 8, 8, 8}, {3350, 8, 2, 2}, {3358, 8, 1, 1}, {3366, 8, 1, 0}, {3374, 8, 1, 0}, {3382, 8, 8, 8},
+        {3390, 8, 8, 8}, {3398, 8, 3, 2}, {3406, 8, 2, 1}, {3414, 8, 1, 0}, {3422, 8, 2, 1}, {3430, 8, 8, 8},
+        {3438, 8, 8, 8}, {3446, 8, 2, 2}, {3454, 8, 1, 1}, {3462, 8, 1, 0}, {3470, 8, 1, 1}, {3478, 8, 1, 4},
+        {3486, 8, 8, 8}, {3494, 8, 3, 1}, {3502, 8, 2, 0}, {3510, 8, 1, 0}, {3518, 8, 2, 0}, {3526, 8, 5, 0},
+        {3534, 7, 7, 7}, {3541, 7, 2, 1}, {3548, 7, 1, 0}, {3555, 7, 1, 3}, {3562, 7, 1, 3}, {3569, 7, 7, 7},
+        {3576, 6, 6, 6}, {3582, 6, 2, 1}, {3588, 6, 1, 0}, {3594, 6, 1, 0}, {3600, 6, 1, 0}, {3606, 6, 6, 6},
+        {3612, 6, 2, 3}, {3618, 6, 1, 1}, {3624, 6, 1, 0}, {3630, 6, 1, 1}, {3636, 6, 2, 0}, {3642, 6, 6, 6},
+        {3648, 8, 8, 8}, {3656, 8, 2, 1}, {3664, 8, 1, 0}, {3672, 8, 1, 0}, {3680, 8, 2, 0}, {3688, 8, 8, 8},
+        {3696, 8, 8, 8}, {3704, 8, 1, 0}, {3712, 8, 1, 0}, {3720, 8, 2, 1}, {3728, 8, 3, 2}, {3736, 8, 8, 8},
+        {3744, 11, 11, 11}, {3755, 11, 1, 0}, {3766, 11, 1, 0}, {3777, 11, 2, 1}, {3788, 11, 3, 2}, {3799, 11, 11, 11},
+        {3810, 7, 7, 7}, {3817, 7, 1, 0}, {3824, 7, 1, 0}, {3831, 7, 2, 1}, {3838, 7, 1, 0}, {3845, 7, 7, 7},
+        {3852, 8, 8, 8}, {3860, 8, 2, 1}, {3868, 8, 1, 0}, {3876, 8, 1, 0}, {3884, 8, 2, 0}, {3892, 8, 2, 1},
+        {3900, 6, 6, 6}, {3906, 6, 2, 0}, {3912, 6, 1, 0}, {3918, 6, 2, 1}, {3924, 6, 1, 0}, {3930, 6, 6, 6},
+        {3936, 6, 4, 0}, {3942, 6, 3, 0}, {3948, 6, 2, 1}, {3954, 6, 1, 2}, {3960, 6, 2, 1}, {3966, 6, 3, 0},
+        {3972, 4, 2, 1}, {3976, 4, 1, 0}, {3980, 4, 1, 0}, {3984, 4, 1, 0}, {3988, 4, 1, 0}, {3992, 4, 1, 0},
+        {3996, 6, 1, 3}, {4002, 6, 1, 2}, {4008, 6, 2, 1}, {4014, 6, 3, 0}, {4020, 6, 2, 1}, {4026, 6, 1, 2},
+        {4032, 6, 2, 0}, {4038, 6, 1, 1}, {4044, 6, 3, 2}, {4050, 6, 3, 2}, {4056, 6, 3, 2}, {4062, 6, 6, 6},
+      };
+
+      static constexpr std::uint32_t glyphs[] = {
+        36, 32, 36, 36, 32, 36, 36, 32, 36, 36, 32, 36, 36, 32, 36, 36,
+        32, 36, 32, 32, 95, 32, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124,
+        95, 124, 32, 40, 95, 41, 32, 32, 32, 32, 32, 32, 95, 32, 95, 32,
+        32, 40, 32, 124, 32, 41, 32, 32, 86, 32, 86, 32, 32, 32, 32, 36,
+        32, 32, 32, 32, 32, 36, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 95, 32, 32, 95, 32, 32, 32, 32, 32, 95, 124, 32, 124, 124,
+        32, 124, 95, 32, 32, 124, 95, 32, 32, 46, 46, 32, 32, 95, 124, 32,
+        124, 95, 32, 32, 32, 32, 32, 32, 95, 124, 32, 32, 32, 124, 95, 124,
+        124, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 95, 32, 32, 32, 32, 124, 32, 124, 32, 32, 47, 32, 95,
+        95, 41, 32, 92, 95, 95, 32, 92, 32, 40, 32, 32, 32, 47, 32, 32,
+        124, 95, 124, 32, 32, 32, 95, 32, 32, 95, 95, 32, 40, 95, 41, 47,
+        32, 47, 32, 32, 32, 47, 32, 47, 32, 32, 32, 47, 32, 47, 95, 32,
+        32, 47, 95, 47, 40, 95, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 95, 95, 95, 32, 32, 32, 32, 32, 40, 32, 95, 32, 41, 32, 32,
+        32, 32, 47, 32, 95, 32, 92, 47, 92, 32, 124, 32, 40, 95, 62, 32,
+        32, 60, 32, 32, 92, 95, 95, 95, 47, 92, 47, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 95, 32, 32, 40, 32, 41, 32, 124, 47, 32,
+        32, 32, 36, 32, 32, 32, 36, 32, 32, 32, 32, 32, 32, 32, 32, 95,
+        95, 32, 32, 47, 32, 47, 32, 124, 32, 124, 32, 32, 124, 32, 124, 32,
+        32, 124, 32, 124, 32, 32, 32, 92, 95, 92, 32, 95, 95, 32, 32, 32,
+        92, 32, 92, 32, 32, 32, 124, 32, 124, 32, 32, 124, 32, 124, 32, 32,
+        124, 32, 124, 32, 47, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        95, 95, 47, 92, 95, 95, 32, 92, 32, 32, 32, 32, 47, 32, 47, 95,
+        32, 32, 95, 92, 32, 32, 32, 92, 47, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 32,
+        32, 32, 32, 32, 95, 124, 32, 124, 95, 32, 32, 124, 95, 32, 32, 32,
+        95, 124, 32, 32, 32, 124, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        95, 32, 32, 40, 32, 41, 32, 124, 47, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95,
+        95, 32, 32, 124, 95, 95, 95, 95, 95, 124, 32, 32, 32, 32, 36, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 40, 95, 41, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 32, 32, 47, 32, 47,
+        32, 32, 32, 47, 32, 47, 32, 32, 32, 47, 32, 47, 32, 32, 32, 47,
+        95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95,
+        95, 95, 32, 32, 32, 32, 47, 32, 95, 32, 92, 32, 32, 124, 32, 124,
+        32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 124, 32, 32, 92, 95,
+        95, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 32,
+        32, 47, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 95, 124,
+        32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 124, 95, 95,
+        95, 32, 92, 32, 32, 32, 32, 95, 95, 41, 32, 124, 32, 32, 47, 32,
+        95, 95, 47, 32, 32, 124, 95, 95, 95, 95, 95, 124, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 95, 32, 32, 124, 95, 95,
+        95, 32, 47, 32, 32, 32, 32, 124, 95, 32, 92, 32, 32, 32, 95, 95,
+        95, 41, 32, 124, 32, 124, 95, 95, 95, 95, 47, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 95, 32, 32, 95, 32, 32, 32, 32, 124, 32,
+        124, 124, 32, 124, 32, 32, 32, 124, 32, 124, 124, 32, 124, 95, 32, 32,
+        124, 95, 95, 32, 32, 32, 95, 124, 32, 32, 32, 32, 124, 95, 124, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95,
+        32, 32, 32, 124, 32, 95, 95, 95, 124, 32, 32, 124, 95, 95, 95, 32,
+        92, 32, 32, 32, 95, 95, 95, 41, 32, 124, 32, 124, 95, 95, 95, 95,
+        47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32,
+        32, 32, 32, 32, 47, 32, 47, 95, 32, 32, 32, 124, 32, 39, 95, 32,
+        92, 32, 32, 124, 32, 40, 95, 41, 32, 124, 32, 32, 92, 95, 95, 95,
+        47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95,
+        95, 32, 32, 124, 95, 95, 95, 32, 32, 124, 32, 32, 32, 32, 47, 32,
+        47, 32, 32, 32, 32, 47, 32, 47, 32, 32, 32, 32, 47, 95, 47, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95,
+        32, 32, 32, 32, 40, 32, 95, 32, 41, 32, 32, 32, 47, 32, 95, 32,
+        92, 32, 32, 124, 32, 40, 95, 41, 32, 124, 32, 32, 92, 95, 95, 95,
+        47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95,
+        32, 32, 32, 32, 47, 32, 95, 32, 92, 32, 32, 124, 32, 40, 95, 41,
+        32, 124, 32, 32, 92, 95, 95, 44, 32, 124, 32, 32, 32, 32, 47, 95,
+        47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        95, 32, 32, 40, 95, 41, 32, 32, 95, 32, 32, 40, 95, 41, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 40, 95, 41, 32, 32,
+        95, 32, 32, 40, 32, 41, 32, 124, 47, 32, 32, 32, 32, 95, 95, 32,
+        32, 47, 32, 47, 32, 47, 32, 47, 32, 32, 92, 32, 92, 32, 32, 32,
+        92, 95, 92, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 95, 95, 95, 95, 95, 32, 32, 124, 95, 95, 95, 95, 95, 124,
+        32, 124, 95, 95, 95, 95, 95, 124, 32, 32, 32, 32, 36, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 32, 92, 32,
+        92, 32, 32, 32, 92, 32, 92, 32, 32, 47, 32, 47, 32, 47, 95, 47,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 32, 32, 124, 95, 95,
+        32, 92, 32, 32, 32, 47, 32, 47, 32, 32, 124, 95, 124, 32, 32, 32,
+        40, 95, 41, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
+        95, 95, 32, 32, 32, 32, 32, 47, 32, 95, 95, 32, 92, 32, 32, 32,
+        47, 32, 47, 32, 95, 96, 32, 124, 32, 124, 32, 124, 32, 40, 95, 124,
+        32, 124, 32, 32, 92, 32, 92, 95, 95, 44, 95, 124, 32, 32, 32, 92,
+        95, 95, 95, 95, 47, 32, 32, 32, 32, 32, 32, 95, 32, 32, 32, 32,
+        32, 32, 32, 32, 47, 32, 92, 32, 32, 32, 32, 32, 32, 47, 32, 95,
+        32, 92, 32, 32, 32, 32, 47, 32, 95, 95, 95, 32, 92, 32, 32, 47,
+        95, 47, 32, 32, 32, 92, 95, 92, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 124, 32, 95, 95, 32,
+        41, 32, 32, 124, 32, 32, 95, 32, 92, 32, 32, 124, 32, 124, 95, 41,
+        32, 124, 32, 124, 95, 95, 95, 95, 47, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 47, 32, 95, 95,
+        95, 124, 32, 124, 32, 124, 32, 32, 32, 32, 32, 124, 32, 124, 95, 95,
+        95, 32, 32, 32, 92, 95, 95, 95, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 124, 32, 32, 95, 32,
+        92, 32, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 95, 124,
+        32, 124, 32, 124, 95, 95, 95, 95, 47, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 95, 95, 32, 32, 124, 32, 95, 95, 95,
+        95, 124, 32, 124, 32, 32, 95, 124, 32, 32, 32, 124, 32, 124, 95, 95,
+        95, 32, 32, 124, 95, 95, 95, 95, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 95, 95, 32, 32, 124, 32, 32, 95, 95,
+        95, 124, 32, 124, 32, 124, 95, 32, 32, 32, 32, 124, 32, 32, 95, 124,
+        32, 32, 32, 124, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 47, 32, 95, 95,
+        95, 124, 32, 124, 32, 124, 32, 32, 95, 32, 32, 124, 32, 124, 95, 124,
+        32, 124, 32, 32, 92, 95, 95, 95, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 32, 32, 32, 95, 32, 32, 124, 32, 124, 32, 124,
+        32, 124, 32, 124, 32, 124, 95, 124, 32, 124, 32, 124, 32, 32, 95, 32,
+        32, 124, 32, 124, 95, 124, 32, 124, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 32, 32, 124, 95, 32, 95, 124, 32, 32,
+        124, 32, 124, 32, 32, 32, 124, 32, 124, 32, 32, 124, 95, 95, 95, 124,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 32,
+        32, 32, 32, 124, 32, 124, 32, 32, 95, 32, 32, 124, 32, 124, 32, 124,
+        32, 124, 95, 124, 32, 124, 32, 32, 92, 95, 95, 95, 47, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 95, 95, 32, 124, 32,
+        124, 47, 32, 47, 32, 124, 32, 39, 32, 47, 32, 32, 124, 32, 46, 32,
+        92, 32, 32, 124, 95, 124, 92, 95, 92, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 95, 32, 32, 32, 32, 32, 32, 124, 32, 124, 32, 32, 32, 32,
+        32, 124, 32, 124, 32, 32, 32, 32, 32, 124, 32, 124, 95, 95, 95, 32,
+        32, 124, 95, 95, 95, 95, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 95, 95, 32, 32, 95, 95, 32, 32, 124, 32, 32, 92, 47, 32,
+        32, 124, 32, 124, 32, 124, 92, 47, 124, 32, 124, 32, 124, 32, 124, 32,
+        32, 124, 32, 124, 32, 124, 95, 124, 32, 32, 124, 95, 124, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 32, 95, 32, 32, 124,
+        32, 92, 32, 124, 32, 124, 32, 124, 32, 32, 92, 124, 32, 124, 32, 124,
+        32, 124, 92, 32, 32, 124, 32, 124, 95, 124, 32, 92, 95, 124, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 32, 32, 32, 32,
+        47, 32, 95, 32, 92, 32, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124,
+        32, 124, 95, 124, 32, 124, 32, 32, 92, 95, 95, 95, 47, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 124,
+        32, 32, 95, 32, 92, 32, 32, 124, 32, 124, 95, 41, 32, 124, 32, 124,
+        32, 32, 95, 95, 47, 32, 32, 124, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 32, 32, 32, 32,
+        47, 32, 95, 32, 92, 32, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124,
+        32, 124, 95, 124, 32, 124, 32, 32, 92, 95, 95, 92, 95, 92, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 124,
+        32, 32, 95, 32, 92, 32, 32, 124, 32, 124, 95, 41, 32, 124, 32, 124,
+        32, 32, 95, 32, 60, 32, 32, 124, 95, 124, 32, 92, 95, 92, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 32, 32, 32, 47,
+        32, 95, 95, 95, 124, 32, 32, 92, 95, 95, 95, 32, 92, 32, 32, 32,
+        95, 95, 95, 41, 32, 124, 32, 124, 95, 95, 95, 95, 47, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 95, 32, 32, 124,
+        95, 32, 32, 32, 95, 124, 32, 32, 32, 124, 32, 124, 32, 32, 32, 32,
+        32, 124, 32, 124, 32, 32, 32, 32, 32, 124, 95, 124, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 32, 95, 32, 32, 124,
+        32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124,
+        32, 124, 95, 124, 32, 124, 32, 32, 92, 95, 95, 95, 47, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 32, 32, 32, 95, 95,
+        32, 92, 32, 92, 32, 32, 32, 47, 32, 47, 32, 32, 92, 32, 92, 32,
+        47, 32, 47, 32, 32, 32, 32, 92, 32, 86, 32, 47, 32, 32, 32, 32,
+        32, 32, 92, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 95, 95, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32,
+        92, 32, 92, 32, 32, 32, 32, 32, 32, 47, 32, 47, 32, 32, 92, 32,
+        92, 32, 47, 92, 32, 47, 32, 47, 32, 32, 32, 32, 92, 32, 86, 32,
+        32, 86, 32, 47, 32, 32, 32, 32, 32, 32, 92, 95, 47, 92, 95, 47,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 95, 95, 32, 32, 95, 95, 32, 92, 32, 92, 47, 32, 47, 32, 32,
+        92, 32, 32, 47, 32, 32, 32, 47, 32, 32, 92, 32, 32, 47, 95, 47,
+        92, 95, 92, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 32,
+        95, 95, 32, 92, 32, 92, 32, 47, 32, 47, 32, 32, 92, 32, 86, 32,
+        47, 32, 32, 32, 32, 124, 32, 124, 32, 32, 32, 32, 32, 124, 95, 124,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95,
+        95, 32, 124, 95, 95, 32, 32, 47, 32, 32, 32, 47, 32, 47, 32, 32,
+        32, 47, 32, 47, 95, 32, 32, 47, 95, 95, 95, 95, 124, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 124, 32, 95, 124, 32, 124,
+        32, 124, 32, 32, 124, 32, 124, 32, 32, 124, 32, 124, 32, 32, 124, 95,
+        95, 124, 32, 95, 95, 32, 32, 32, 32, 32, 92, 32, 92, 32, 32, 32,
+        32, 32, 92, 32, 92, 32, 32, 32, 32, 32, 92, 32, 92, 32, 32, 32,
+        32, 32, 92, 95, 92, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95,
+        32, 32, 124, 95, 32, 124, 32, 32, 124, 32, 124, 32, 32, 124, 32, 124,
+        32, 32, 124, 32, 124, 32, 124, 95, 95, 124, 32, 32, 47, 92, 32, 32,
+        124, 47, 92, 124, 32, 32, 32, 36, 32, 32, 32, 32, 36, 32, 32, 32,
+        32, 36, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 95, 95, 32,
+        32, 124, 95, 95, 95, 95, 95, 124, 32, 32, 95, 32, 32, 40, 32, 41,
+        32, 32, 92, 124, 32, 32, 36, 32, 32, 32, 36, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 95, 32,
+        32, 32, 47, 32, 95, 96, 32, 124, 32, 124, 32, 40, 95, 124, 32, 124,
+        32, 32, 92, 95, 95, 44, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 95, 32, 32, 32, 32, 32, 32, 124, 32, 124, 95, 95, 32, 32,
+        32, 124, 32, 39, 95, 32, 92, 32, 32, 124, 32, 124, 95, 41, 32, 124,
+        32, 124, 95, 46, 95, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 32, 32, 32,
+        47, 32, 95, 95, 124, 32, 124, 32, 40, 95, 95, 32, 32, 32, 92, 95,
+        95, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        95, 32, 32, 32, 32, 95, 95, 124, 32, 124, 32, 32, 47, 32, 95, 96,
+        32, 124, 32, 124, 32, 40, 95, 124, 32, 124, 32, 32, 92, 95, 95, 44,
+        95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 32, 32, 32, 47, 32, 95, 32, 92, 32,
+        124, 32, 32, 95, 95, 47, 32, 32, 92, 95, 95, 95, 124, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 32, 47, 32, 95, 124,
+        32, 124, 32, 124, 95, 32, 32, 124, 32, 32, 95, 124, 32, 124, 95, 124,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 95, 95, 32, 95, 32, 32, 32, 47, 32, 95, 96, 32, 124,
+        32, 124, 32, 40, 95, 124, 32, 124, 32, 32, 92, 95, 95, 44, 32, 124,
+        32, 32, 124, 95, 95, 95, 47, 32, 32, 32, 95, 32, 32, 32, 32, 32,
+        32, 124, 32, 124, 95, 95, 32, 32, 32, 124, 32, 39, 95, 32, 92, 32,
+        32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 124, 95, 124,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 40, 95, 41,
+        32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 32, 32, 32, 32, 40, 95, 41, 32, 32, 32, 124,
+        32, 124, 32, 32, 32, 124, 32, 124, 32, 32, 95, 47, 32, 124, 32, 124,
+        95, 95, 47, 32, 32, 32, 95, 32, 32, 32, 32, 32, 124, 32, 124, 32,
+        95, 95, 32, 124, 32, 124, 47, 32, 47, 32, 124, 32, 32, 32, 60, 32,
+        32, 124, 95, 124, 92, 95, 92, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        95, 32, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124,
+        95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 32, 95, 95, 32, 95, 95, 95, 32, 32, 32, 124,
+        32, 39, 95, 32, 96, 32, 95, 32, 92, 32, 32, 124, 32, 124, 32, 124,
+        32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 124, 95, 124, 32, 124,
+        95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 95, 95, 32, 32, 32, 124,
+        32, 39, 95, 32, 92, 32, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124,
+        95, 124, 32, 124, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 95, 32, 32, 32, 32,
+        47, 32, 95, 32, 92, 32, 32, 124, 32, 40, 95, 41, 32, 124, 32, 32,
+        92, 95, 95, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 95, 95, 32, 32, 32, 124,
+        32, 39, 95, 32, 92, 32, 32, 124, 32, 124, 95, 41, 32, 124, 32, 124,
+        32, 46, 95, 95, 47, 32, 32, 124, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 95, 32, 32, 32,
+        47, 32, 95, 96, 32, 124, 32, 124, 32, 40, 95, 124, 32, 124, 32, 32,
+        92, 95, 95, 44, 32, 124, 32, 32, 32, 32, 32, 124, 95, 124, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 95, 32, 95, 95, 32, 32, 124, 32, 39,
+        95, 95, 124, 32, 124, 32, 124, 32, 32, 32, 32, 124, 95, 124, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        95, 95, 95, 32, 32, 47, 32, 95, 95, 124, 32, 92, 95, 95, 32, 92,
+        32, 124, 95, 95, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 95, 32,
+        32, 32, 32, 124, 32, 124, 95, 32, 32, 124, 32, 95, 95, 124, 32, 124,
+        32, 124, 95, 32, 32, 32, 92, 95, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 32, 32, 32, 95, 32,
+        32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 124,
+        32, 32, 92, 95, 95, 44, 95, 124, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 32, 95, 95,
+        32, 92, 32, 92, 32, 47, 32, 47, 32, 32, 92, 32, 86, 32, 47, 32,
+        32, 32, 32, 92, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32,
+        32, 32, 32, 32, 95, 95, 32, 92, 32, 92, 32, 47, 92, 32, 47, 32,
+        47, 32, 32, 92, 32, 86, 32, 32, 86, 32, 47, 32, 32, 32, 32, 92,
+        95, 47, 92, 95, 47, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 95, 95, 32, 32, 95, 95,
+        32, 92, 32, 92, 47, 32, 47, 32, 32, 62, 32, 32, 60, 32, 32, 47,
+        95, 47, 92, 95, 92, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 32, 32, 95, 32, 32, 32, 95, 32, 32, 124, 32, 124,
+        32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 124, 32, 32, 92, 95,
+        95, 44, 32, 124, 32, 32, 124, 95, 95, 95, 47, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 95, 95, 32, 124, 95, 32, 32, 47, 32, 32,
+        47, 32, 47, 32, 32, 47, 95, 95, 95, 124, 32, 32, 32, 32, 32, 32,
+        32, 32, 32, 32, 95, 95, 32, 32, 32, 47, 32, 47, 32, 32, 124, 32,
+        124, 32, 32, 60, 32, 60, 32, 32, 32, 32, 124, 32, 124, 32, 32, 32,
+        32, 92, 95, 92, 32, 32, 95, 32, 32, 124, 32, 124, 32, 124, 32, 124,
+        32, 124, 32, 124, 32, 124, 32, 124, 32, 124, 95, 124, 32, 95, 95, 32,
+        32, 32, 32, 92, 32, 92, 32, 32, 32, 32, 124, 32, 124, 32, 32, 32,
+        32, 62, 32, 62, 32, 32, 124, 32, 124, 32, 32, 47, 95, 47, 32, 32,
+        32, 32, 47, 92, 47, 124, 32, 124, 47, 92, 47, 32, 32, 32, 32, 36,
+        32, 32, 32, 32, 32, 36, 32, 32, 32, 32, 32, 36, 32, 32, 32, 32,
+        32, 32, 32, 32, 0,
+      };
+    };
+
+    using standard_font  = basic_embedded_font<std::string, standard_font_data>;
+    using wstandard_font = basic_embedded_font<std::wstring, standard_font_data>;
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_EMBEDDED_STANDARD_FONT_HPP
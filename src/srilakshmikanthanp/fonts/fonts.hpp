@@ -9,18 +9,22 @@
 
 #include "../abstract/abstract.hpp"
 #include "../utility/functions.hpp"
+#include "../utility/parallel.hpp"
 #include "../types/types.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <map>
 #include <iomanip>
-#include <regex>
 #include <vector>
 #include <memory>
 #include <fstream>
 #include <sstream>
+#include <string_view>
+#include <limits>
+#include <filesystem>
 
 namespace srilakshmikanthanp
 {
@@ -37,9 +41,13 @@ namespace srilakshmikanthanp
       using char_type        =   typename string_type_t::value_type;      // Character Type
       using traits_type      =   typename string_type_t::traits_type;     // Traits Type
       using size_type        =   typename string_type_t::size_type;       // Size Type
+      using allocator_type   =   typename string_type_t::allocator_type;  // Allocator Type
 
-      using fig_char_type    =   std::vector<string_type_t>;              // Figlet char
-      using fig_str_type     =   std::vector<string_type_t>;              // Figlet String
+      using fig_char_type    =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type     =   basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using fig_char_view_type =  basic_fig_char_view<char_type, traits_type>;        // Figlet char view
 
     private:                                                              // private typedefs
       using sstream_type     =   std::basic_stringstream<char_type>;      // Sstream Type
@@ -47,18 +55,32 @@ namespace srilakshmikanthanp
       using istream_type     =   std::basic_istream<char_type>;           // Istream Type
       using ifstream_type    =   std::basic_ifstream<char_type>;          // Ifstream Type
       using ofstream_type    =   std::basic_ofstream<char_type>;          // Ofstream Type
+      using token_type       =   std::basic_string<char_type>;            // Header token Type
 
     private:                                                              // Private types definition
-      using map_type = std::map<char_type, fig_char_type>;
+      using rows_type = basic_alloc_vector<string_type_t, fig_row_type>;
       using ibuff_it = std::istreambuf_iterator<char_type>;
 
+    private:                                                              // Private constants
+      static constexpr char_type first_char = ' ';                        // first fig char
+      static constexpr char_type last_char  = '~';                        // last fig char
+      static constexpr char32_t dense_size = 256;                         // code points in the dense index
+      static constexpr std::uint32_t npos = std::uint32_t(-1);            // not a fig char of the font
+
+      // required Deutsch fig chars after ascii
+      static constexpr char32_t deutsch_codes[] = {196, 214, 220, 228, 246, 252, 223};
+
     private:                                                              // Private configs
       char_type hard_blank;
       size_type height;
       shrink_type shrink;
+      layout_type layout;
 
     private:                                                              // Private characters
-      map_type fig_chars;
+      string_type glyphs;                                                 // rows of all fig chars
+      rows_type rows;                                                     // row table of fig chars
+      basic_alloc_vector<string_type_t, std::uint32_t> dense;             // index of the code points below dense_size
+      basic_alloc_vector<string_type_t, std::pair<char32_t, std::uint32_t>> sparse;   // index of the other code points, sorted
 
     private:                                                              // Private utilities
       /**
@@ -67,7 +89,7 @@ namespace srilakshmikanthanp
       void read_config_and_remove_comments(istream_type &is)
       {
         // flf header line container
-        string_type flf_config_line;
+        token_type flf_config_line;
 
         // get the first line
         std::getline(is, flf_config_line);
@@ -76,13 +98,13 @@ namespace srilakshmikanthanp
         sstream_type ss(flf_config_line);
 
         // token
-        string_type token;
+        token_type token;
 
         // Read header
         ss >> std::setw(5) >> token;
 
         // check
-        if (token != cvt<string_type>("flf2a"))
+        if (token != cvt<token_type>("flf2a"))
         {
           throw std::runtime_error("Invalid flf2a header");
         }
@@ -132,23 +154,8 @@ namespace srilakshmikanthanp
           throw std::runtime_error("Invalid old layout");
         }
 
-        // set shrink level
-        const auto old_layout = std::stoi(token);
-
-        if (old_layout < 0) // less than 0 then FULL_WIDTH
-        {
-          this->shrink = shrink_type::FULL_WIDTH;
-        }
-
-        if (old_layout == 0) // equal to 0 then KERNING
-        {
-          this->shrink = shrink_type::KERNING;
-        }
-
-        if (old_layout > 0) // greater than 0 then SMUSHED
-        {
-          this->shrink = shrink_type::SMUSHED;
-        }
+        // layout of the old layout
+        this->layout = make_layout(std::stoi(token));
 
         // Read comment lines
         ss >> token;
@@ -162,6 +169,19 @@ namespace srilakshmikanthanp
         // check and set
         const auto comment_lines = std::stoi(token);
 
+        // Read print direction and full layout (optional)
+        if (ss >> token && ss >> token)
+        {
+          // full layout overrides the old layout
+          if (const auto full_layout = std::stoi(token); full_layout >= 0 && full_layout < 32768)
+          {
+            this->layout = static_cast<layout_type>(full_layout) & fig_layout::HORIZONTAL;
+          }
+        }
+
+        // set shrink level
+        this->shrink = layout_shrink_level(this->layout);
+
         // ignore comment lines
         for (auto i = 0; i < comment_lines; ++i)
         {
@@ -170,70 +190,233 @@ namespace srilakshmikanthanp
       }
 
       /**
-       * @brief Read the characters from the stream
+       * @brief check the character is a line terminator
        */
-      void read_chars(istream_type &is)
+      static bool is_line_terminator(char_type ch)
+      {
+        // code point of the character
+        const auto code = traits_type::to_int_type(ch);
+
+        // \n, \r and the unicode line/paragraph separators
+        return code == 0x0A || code == 0x0D || code == 0x2028 || code == 0x2029;
+      }
+
+      /**
+       * @brief Remove the endmark of the fig char line in place
+       *
+       * @details strips the last character and one more if it equals the
+       * last, a line ending with line terminator or an empty line is kept
+       * with a new line appended (same as replacing "(.)\\1?\n" on line)
+       */
+      static void remove_endmark(string_type &line)
+      {
+        // nothing to match keep the new line
+        if (line.empty() || is_line_terminator(line.back()))
+        {
+          return line.push_back(traits_type::to_char_type('\n'));
+        }
+
+        // endmark character
+        const auto endmark = line.back();
+
+        // remove the endmark
+        line.pop_back();
+
+        // remove the doubled endmark
+        if (!line.empty() && traits_type::eq(line.back(), endmark))
+        {
+          line.pop_back();
+        }
+      }
+
+      /**
+       * @brief Read the rows of a fig char from the stream
+       *
+       * @return false if the stream ended before the height, nothing is added then
+       */
+      bool read_fig_char(istream_type &is, string_type &line)
       {
-        // lambda function to convert the lines to fig char
-        auto to_fig_char = [this](const std::vector<string_type> &lines) {
-          // regex pattern to match
-          std::basic_regex<char_type> pattern(cvt<string_type>("(.)\\1?\n"), std::regex::ECMAScript);
+        // size before the fig char
+        const auto glyphs_size = this->glyphs.size();
+        const auto rows_size = this->rows.size();
+
+        // rows read
+        size_type count = 0;
+
+        // read lines
+        for (; count < this->height && std::getline(is, line); ++count)
+        {
+          // remove the endmark
+          this->remove_endmark(line);
+
+          // check buffer limit
+          if (this->glyphs.size() + line.size() > std::numeric_limits<std::uint32_t>::max())
+          {
+            throw std::runtime_error("Font too large");
+          }
+
+          // add the row
+          this->rows.push_back(make_fig_row(static_cast<std::uint32_t>(this->glyphs.size()), string_view_type(line)));
+
+          // add the row characters
+          this->glyphs += line;
+        }
+
+        // drop the partial fig char
+        if (count != this->height)
+        {
+          this->glyphs.resize(glyphs_size);
+          this->rows.resize(rows_size);
+          return false;
+        }
 
-          // fig char container
-          fig_char_type fig_char;
+        return true;
+      }
 
-          // line
-          string_type line;
+      /**
+       * @brief Add the last read fig char to the index of the code point
+       */
+      void add_code(char32_t code)
+      {
+        // index of the fig char
+        const auto index = static_cast<std::uint32_t>(this->rows.size() / this->height - 1);
 
-          // read lines
-          for (const auto &line : lines)
+        // first fig char of the code point is kept
+        if (code < dense_size)
+        {
+          if (this->dense[code] == npos)
           {
-            fig_char.push_back(std::regex_replace(line + cvt<string_type>("\n"), pattern, cvt<string_type>("")));
+            this->dense[code] = index;
           }
+        }
+        else
+        {
+          this->sparse.emplace_back(code, index);
+        }
+      }
+
+      /**
+       * @brief Parse the code of the code tag line (decimal, octal or hex)
+       *
+       * @return false if the line is not a code tag
+       */
+      static bool parse_code_tag(const string_type &line, long &code)
+      {
+        // code as narrow string
+        std::string token;
+
+        for (const auto ch : line)
+        {
+          const auto c = traits_type::to_int_type(ch);
 
-          // check height
-          if (fig_char.size() != this->height)
+          if (c == ' ' || c == '\t' || c < 0 || c > 127)
           {
-            throw std::runtime_error("Height not match");
+            break;
           }
 
-          // return
-          return fig_char;
-        };
+          token += static_cast<char>(c);
+        }
+
+        // parse
+        try
+        {
+          std::size_t pos = 0;
+          code = std::stol(token, &pos, 0);
+          return pos == token.size();
+        }
+        catch (const std::exception &)
+        {
+          return false;
+        }
+      }
+
+      /**
+       * @brief Read the characters from the stream
+       *
+       * @details ascii fig chars are required, the Deutsch and code tagged
+       * fig chars after them are read till the end of the font or the first
+       * malformed one, those without a valid code point are skipped
+       */
+      void read_chars(istream_type &is)
+      {
+        // line buffer
+        string_type line(this->glyphs.get_allocator());
 
-        // lambda function to read lines from the stream
-        auto read_lines = [this](istream_type &is, size_type n) {
-          // lines container
-          std::vector<string_type> lines;
+        // read all the characters (ch <= '~' must be first)
+        for (char_type ch = first_char; ch <= last_char; ++ch)
+        {
+          if (!this->read_fig_char(is, line))
+          {
+            throw std::runtime_error("Height not match");
+          }
+        }
 
-          // line
-          string_type line;
+        // index of the other code points
+        this->dense.assign(dense_size, npos);
 
-          // read lines
-          for (auto i = 0; i < n && std::getline(is, line); ++i)
+        // Deutsch fig chars
+        for (const auto code : deutsch_codes)
+        {
+          if (!this->read_fig_char(is, line))
           {
-            lines.push_back(line);
+            break;
           }
 
-          // return
-          return lines;
-        };
+          this->add_code(code);
+        }
 
-        // read all the characters (ch <= '~' must be first)
-        for (char_type ch = ' '; ch <= '~'; ++ch)
+        // code tagged fig chars
+        for (long code = 0; std::getline(is, line) && parse_code_tag(line, code);)
         {
-          // get the fig char
-          const auto fig_char = to_fig_char(read_lines(is, this->height));
+          if (!this->read_fig_char(is, line))
+          {
+            break;
+          }
 
-          // if length less
-          if (fig_char.size() < this->height)
+          if (code >= 0 && code <= 0x10FFFF)
           {
-            throw std::runtime_error("Invalid fig char");
+            this->add_code(static_cast<char32_t>(code));
           }
+        }
+
+        // sort the sparse index, first fig char of the code point is kept
+        std::stable_sort(this->sparse.begin(), this->sparse.end(), [](const auto &a, const auto &b) {
+          return a.first < b.first;
+        });
+
+        this->sparse.erase(std::unique(this->sparse.begin(), this->sparse.end(), [](const auto &a, const auto &b) {
+          return a.first == b.first;
+        }), this->sparse.end());
+
+        // release the unused buffer
+        this->glyphs.shrink_to_fit();
+        this->rows.shrink_to_fit();
+        this->sparse.shrink_to_fit();
+      }
+
+      /**
+       * @brief Get the index of the fig char of the code point or npos
+       */
+      std::uint32_t index_of(char32_t code) const
+      {
+        // ascii
+        if (code - first_char <= char32_t(last_char - first_char))
+        {
+          return code - first_char;
+        }
 
-          // insert the fig char
-          this->fig_chars.insert({ch, fig_char});
+        // dense
+        if (code < dense_size)
+        {
+          return this->dense[code];
         }
+
+        // sparse
+        const auto itr = std::lower_bound(this->sparse.begin(), this->sparse.end(), code, [](const auto &entry, char32_t c) {
+          return entry.first < c;
+        });
+
+        return itr != this->sparse.end() && itr->first == code ? itr->second : npos;
       }
 
       /**
@@ -256,7 +439,8 @@ namespace srilakshmikanthanp
       /**
        * @brief From istream
        */
-      explicit basic_flf_font(istream_type &is)
+      explicit basic_flf_font(istream_type &is, const allocator_type &alloc = allocator_type())
+        : glyphs(alloc), rows(alloc), dense(alloc), sparse(alloc)
       {
         this->init(is);
       }
@@ -264,7 +448,8 @@ namespace srilakshmikanthanp
       /**
        * @brief From file
        */
-      explicit basic_flf_font(const std::string &file)
+      explicit basic_flf_font(const std::string &file, const allocator_type &alloc = allocator_type())
+        : glyphs(alloc), rows(alloc), dense(alloc), sparse(alloc)
       {
         // file stream
         ifstream_type ifs(file);
@@ -305,37 +490,209 @@ namespace srilakshmikanthanp
       }
 
       /**
-       * @brief Get the fig char
+       * @brief Get the horizontal layout
+       */
+      layout_type get_layout() const override
+      {
+        return this->layout;
+      }
+
+      /**
+       * @brief Get the fig char as view to the font
+       */
+      fig_char_view_type get_fig_char_view(char_type ch) const override
+      {
+        return this->get_code_view(to_code(ch));
+      }
+
+      /**
+       * @brief Get the fig char of the code point as view to the font
        */
-      fig_char_type get_fig_char(char_type ch) const override
+      fig_char_view_type get_code_view(char32_t code) const override
       {
+        // fig char view
+        fig_char_view_type view;
+
         // check
-        if (ch < ' ' || ch > '~')
+        if (!this->find_code_view(code, view))
+        {
+          throw std::runtime_error("Invalid character : " + std::to_string(code));
+        }
+
+        // return
+        return view;
+      }
+
+      /**
+       * @brief Find the fig char of the code point without throwing
+       */
+      bool find_code_view(char32_t code, fig_char_view_type &view) const override
+      {
+        // index of the fig char
+        const auto index = this->index_of(code);
+
+        // set the view
+        if (index != npos)
         {
-          throw std::runtime_error("Invalid character : " + std::to_string(ch));
+          view = fig_char_view_type(this->glyphs.data(), this->rows.data() + std::size_t(index) * this->height, this->height);
         }
 
         // return
-        return this->fig_chars.at(ch);
+        return index != npos;
+      }
+
+      /**
+       * @brief Get the code points of the fig chars of the font
+       */
+      std::vector<char32_t> get_code_points() const override
+      {
+        std::vector<char32_t> code_points;
+
+        // ascii
+        for (char32_t code = first_char; code <= char32_t(last_char); ++code)
+        {
+          code_points.push_back(code);
+        }
+
+        // dense, the ascii ones are never looked up
+        for (char32_t code = 0; code < this->dense.size(); ++code)
+        {
+          if (this->dense[code] != npos && (code < char32_t(first_char) || code > char32_t(last_char)))
+          {
+            code_points.push_back(code);
+          }
+        }
+
+        // sparse
+        for (const auto &entry : this->sparse)
+        {
+          code_points.push_back(entry.first);
+        }
+
+        std::sort(code_points.begin(), code_points.end());
+
+        return code_points;
+      }
+
+    public: // Public methods
+      /**
+       * @brief Get the memory used by the font in bytes
+       */
+      std::size_t get_memory_usage() const
+      {
+        return sizeof(*this) + this->glyphs.capacity() * sizeof(char_type) + this->rows.capacity() * sizeof(fig_row_type)
+          + this->dense.capacity() * sizeof(std::uint32_t) + this->sparse.capacity() * sizeof(this->sparse.front());
+      }
+
+      /**
+       * @brief Get the allocator of the font
+       */
+      allocator_type get_allocator() const
+      {
+        return this->glyphs.get_allocator();
       }
 
     public: // static methods
       /**
        * @brief Make a flf font type as shared pointer
+       *
+       * @param file font file
+       * @param alloc allocator of the glyphs and the index of the font
        */
-      static auto make_shared(const std::string &file)
+      static auto make_shared(const std::string &file, const allocator_type &alloc = allocator_type())
       {
-        return std::make_shared<basic_flf_font>(file);
+        return std::make_shared<basic_flf_font>(file, alloc);
       }
 
       /**
        * @brief Make a flf font type as shared pointer
+       *
+       * @param is stream of the font
+       * @param alloc allocator of the glyphs and the index of the font
        */
-      static auto make_shared(istream_type &is)
+      static auto make_shared(istream_type &is, const allocator_type &alloc = allocator_type())
       {
-        return std::make_shared<basic_flf_font>(is);
+        return std::make_shared<basic_flf_font>(is, alloc);
       }
     };
+
+    /**
+     * @brief Fonts loaded by load_flf_fonts
+     */
+    template <class string_type_t>
+    struct basic_flf_load_result
+    {
+      std::map<std::string, std::shared_ptr<basic_flf_font<string_type_t>>> fonts;    // fonts by name
+      std::map<std::string, std::string> errors;                                     // errors by name
+    };
+
+    /**
+     * @brief Load the flf fonts in parallel, a font that fails does not stop others
+     *
+     * @param paths font files, named by the file name without extension
+     * @param threads number of threads (0 is the hardware concurrency)
+     */
+    template <class string_type_t>
+    basic_flf_load_result<string_type_t> load_flf_fonts(const std::vector<std::string> &paths, std::size_t threads = 0)
+    {
+      // loaded fonts and errors
+      std::vector<std::shared_ptr<basic_flf_font<string_type_t>>> fonts(paths.size());
+      std::vector<std::string> errors(paths.size());
+
+      // load each font
+      parallel_for(paths.size(), threads, [&](std::size_t i) {
+        try
+        {
+          fonts[i] = basic_flf_font<string_type_t>::make_shared(paths[i]);
+        }
+        catch(const std::exception &e)
+        {
+          errors[i] = e.what();
+        }
+      });
+
+      // result by name
+      basic_flf_load_result<string_type_t> result;
+
+      for (std::size_t i = 0; i < paths.size(); ++i)
+      {
+        const auto name = std::filesystem::path(paths[i]).stem().string();
+
+        if (fonts[i])
+        {
+          result.fonts[name] = std::move(fonts[i]);
+        }
+        else
+        {
+          result.errors[name] = std::move(errors[i]);
+        }
+      }
+
+      return result;
+    }
+
+    /**
+     * @brief Load the flf fonts in the directory in parallel
+     *
+     * @param dir directory of the fonts
+     * @param threads number of threads (0 is the hardware concurrency)
+     */
+    template <class string_type_t>
+    basic_flf_load_result<string_type_t> load_flf_fonts(const std::filesystem::path &dir, std::size_t threads = 0)
+    {
+      // font files
+      std::vector<std::string> paths;
+
+      for (const auto &entry : std::filesystem::directory_iterator(dir))
+      {
+        if (entry.path().extension() == ".flf")
+        {
+          paths.push_back(entry.path().string());
+        }
+      }
+
+      return load_flf_fonts<string_type_t>(paths, threads);
+    }
   }
 }
 
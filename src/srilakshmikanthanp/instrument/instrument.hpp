@@ -0,0 +1,211 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Header Guard
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_INSTRUMENT_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_INSTRUMENT_HPP
+
+#include "../types/types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief What a single render did, given to the instrument of the figlet
+     *
+     * @details the buffer growths are the buffers of the render and the
+     * output whose capacity grew, an allocator may allocate more often than
+     * that (a std::pmr resource can be counted for the exact number)
+     */
+    struct render_event
+    {
+      std::size_t input_size;          // characters of the text
+      std::size_t decoded_code_points; // code points decoded from the text (missing ones too)
+      std::size_t glyphs;              // fig chars of the render
+      shrink_type shrink;              // shrink level of the style
+      std::uint64_t lookup_ns;         // time to look up the fig chars
+      std::uint64_t layout_ns;         // time to lay out the rows (full width, kerning or smushing)
+      std::uint64_t assembly_ns;       // time to join the rows to the output
+      std::size_t buffer_growths;      // buffers whose capacity grew (not a count of allocations)
+      std::size_t buffer_growth_bytes; // bytes the capacity of the buffers grew by
+      std::size_t height;              // rows of the figlet string
+      std::size_t width;               // longest row of the figlet string
+      std::size_t output_size;         // characters of the output
+      bool failed;                     // failed with the missing glyph policy
+    };
+
+    /**
+     * @brief Totals of the render events of a figlet
+     */
+    struct render_stats
+    {
+      std::uint64_t renders;             // renders done
+      std::uint64_t failures;            // renders failed
+      std::uint64_t decoded_code_points; // code points decoded from the texts
+      std::uint64_t glyphs;              // fig chars rendered
+      std::uint64_t lookup_ns;           // time looking up fig chars
+      std::uint64_t full_width_ns;       // time laying out full width
+      std::uint64_t kerning_ns;          // time kerning
+      std::uint64_t smushing_ns;         // time smushing
+      std::uint64_t assembly_ns;         // time joining the rows
+      std::uint64_t buffer_growths;      // buffers whose capacity grew
+      std::uint64_t buffer_growth_bytes; // bytes the capacity of the buffers grew by
+      std::uint64_t output_size;         // characters written
+      std::uint64_t max_width;           // longest row rendered
+    };
+
+    /**
+     * @brief Instrument that records nothing, the figlet compiles the
+     * instrumentation out with it (the default)
+     */
+    struct no_instrument
+    {
+      static constexpr bool enabled = false;                              // no instrumentation
+
+      /**
+       * @brief Ignore the event
+       */
+      void record(const render_event &) const {}
+    };
+
+    /**
+     * @brief Instrument that totals the render events of a figlet and calls
+     * back with each event
+     *
+     * @details counters are atomic so the figlet can render on many threads,
+     * copies of the instrument (and of the figlet) share the counters.
+     */
+    class stats_instrument
+    {
+    public:                                                               // public type definition
+      using callback_type = std::function<void(const render_event &)>;    // Callback Type
+
+      static constexpr bool enabled = true;                               // instrumentation on
+
+    private:                                                              // private types
+      /**
+       * @brief Shared counters of the instrument
+       */
+      struct state_type
+      {
+        std::atomic<std::uint64_t> renders{0};                            // renders done
+        std::atomic<std::uint64_t> failures{0};                           // renders failed
+        std::atomic<std::uint64_t> decoded_code_points{0};                // code points decoded
+        std::atomic<std::uint64_t> glyphs{0};                             // fig chars rendered
+        std::atomic<std::uint64_t> lookup_ns{0};                          // time looking up
+        std::atomic<std::uint64_t> layout_ns[3] = {};                     // time laying out by shrink level
+        std::atomic<std::uint64_t> assembly_ns{0};                        // time joining
+        std::atomic<std::uint64_t> buffer_growths{0};                     // buffers whose capacity grew
+        std::atomic<std::uint64_t> buffer_growth_bytes{0};                // bytes the capacity grew by
+        std::atomic<std::uint64_t> output_size{0};                        // characters written
+        std::atomic<std::uint64_t> max_width{0};                          // longest row
+        callback_type callback;                                           // called with each event
+      };
+
+    private:                                                              // private members
+      std::shared_ptr<state_type> state;                                  // counters
+
+    public:                                                               // public constructors
+      /**
+       * @brief Construct the instrument
+       *
+       * @param callback called with each render event (on the rendering thread)
+       */
+      explicit stats_instrument(callback_type callback = nullptr) : state(std::make_shared<state_type>())
+      {
+        this->state->callback = std::move(callback);
+      }
+
+    public:                                                               // public methods
+      /**
+       * @brief Add the event to the counters
+       */
+      void record(const render_event &event) const
+      {
+        auto &state = *this->state;
+
+        state.renders.fetch_add(1, std::memory_order_relaxed);
+        state.failures.fetch_add(event.failed ? 1 : 0, std::memory_order_relaxed);
+        state.decoded_code_points.fetch_add(event.decoded_code_points, std::memory_order_relaxed);
+        state.glyphs.fetch_add(event.glyphs, std::memory_order_relaxed);
+        state.lookup_ns.fetch_add(event.lookup_ns, std::memory_order_relaxed);
+        state.layout_ns[static_cast<int>(event.shrink)].fetch_add(event.layout_ns, std::memory_order_relaxed);
+        state.assembly_ns.fetch_add(event.assembly_ns, std::memory_order_relaxed);
+        state.buffer_growths.fetch_add(event.buffer_growths, std::memory_order_relaxed);
+        state.buffer_growth_bytes.fetch_add(event.buffer_growth_bytes, std::memory_order_relaxed);
+        state.output_size.fetch_add(event.output_size, std::memory_order_relaxed);
+
+        // longest row
+        auto width = state.max_width.load(std::memory_order_relaxed);
+
+        while (width < event.width && !state.max_width.compare_exchange_weak(width, event.width, std::memory_order_relaxed))
+        {
+          // width is reloaded by the exchange
+        }
+
+        // call back
+        if (state.callback)
+        {
+          state.callback(event);
+        }
+      }
+
+      /**
+       * @brief Get the totals of the events
+       */
+      render_stats get_stats() const
+      {
+        const auto &state = *this->state;
+
+        return {
+          state.renders.load(std::memory_order_relaxed),
+          state.failures.load(std::memory_order_relaxed),
+          state.decoded_code_points.load(std::memory_order_relaxed),
+          state.glyphs.load(std::memory_order_relaxed),
+          state.lookup_ns.load(std::memory_order_relaxed),
+          state.layout_ns[static_cast<int>(shrink_type::FULL_WIDTH)].load(std::memory_order_relaxed),
+          state.layout_ns[static_cast<int>(shrink_type::KERNING)].load(std::memory_order_relaxed),
+          state.layout_ns[static_cast<int>(shrink_type::SMUSHED)].load(std::memory_order_relaxed),
+          state.assembly_ns.load(std::memory_order_relaxed),
+          state.buffer_growths.load(std::memory_order_relaxed),
+          state.buffer_growth_bytes.load(std::memory_order_relaxed),
+          state.output_size.load(std::memory_order_relaxed),
+          state.max_width.load(std::memory_order_relaxed),
+        };
+      }
+
+      /**
+       * @brief Reset the counters
+       */
+      void reset() const
+      {
+        auto &state = *this->state;
+
+        for (auto *counter : {&state.renders, &state.failures, &state.decoded_code_points, &state.glyphs, &state.lookup_ns, &state.layout_ns[0], &state.layout_ns[1], &state.layout_ns[2], &state.assembly_ns, &state.buffer_growths, &state.buffer_growth_bytes, &state.output_size, &state.max_width})
+        {
+          counter->store(0, std::memory_order_relaxed);
+        }
+      }
+    };
+
+    /**
+     * @brief Get the time of the clock in nanoseconds for the instruments
+     */
+    inline std::uint64_t instrument_clock_ns()
+    {
+      return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_INSTRUMENT_HPP
@@ -8,12 +8,23 @@
 #define SRILAKSHMIKANTHANP_LIBFIGLET_LIBFIGLET_HPP
 
 #include "./abstract/abstract.hpp"
+#include "./cache/cache.hpp"
 #include "./constants/constants.hpp"
 #include "./driver/driver.hpp"
 #include "./fonts/fonts.hpp"
+#include "./fonts/compiled.hpp"
+#include "./fonts/embedded.hpp"
+#include "./instrument/instrument.hpp"
+#include "./registry/registry.hpp"
+#include "./stream/stream.hpp"
+#include "./styles/smush.hpp"
 #include "./styles/styles.hpp"
+#include "./styles/accelerated.hpp"
 #include "./types/types.hpp"
 #include "./utility/functions.hpp"
+#include "./utility/simd.hpp"
+
+#include <memory_resource>
 
 namespace srilakshmikanthanp
 {
@@ -24,22 +35,97 @@ namespace srilakshmikanthanp
     using kerning     =   basic_kerning_style<std::string>;
     using smushed     =   basic_smushed_style<std::string>;
 
+    // Styles with precomputed pairs using std::string
+    using accelerated_kerning = basic_accelerated_style<std::string, kerning>;
+    using accelerated_smushed = basic_accelerated_style<std::string, smushed>;
+
     // flf Font Parser using std::string
     using flf_font    =   basic_flf_font<std::string>;
 
+    // Compiled Font using std::string
+    using compiled_font   =   basic_compiled_font<std::string>;
+
+    // Font Registry using std::string
+    using font_registry   =   basic_font_registry<std::string>;
+
     // Figlet Driver using std::string
     using figlet      =   basic_figlet<std::string>;
 
+    // Figlet Driver with statistics using std::string
+    using instrumented_figlet = basic_figlet<std::string, stats_instrument>;
+
+    // Render Batch using std::string
+    using render_batch    =   basic_render_batch<std::string>;
+
+    // Streaming Figlet using std::string
+    using figlet_stream   =   basic_figlet_stream<std::string>;
+
+    // Render Cache using std::string
+    using render_cache    =   basic_render_cache<std::string>;
+
     // Styles for the Figlet using std::wstring
     using wfull_width =   basic_full_width_style<std::wstring>;
     using wkerning    =   basic_kerning_style<std::wstring>;
     using wsmushed    =   basic_smushed_style<std::wstring>;
 
+    // Styles with precomputed pairs using std::wstring
+    using waccelerated_kerning = basic_accelerated_style<std::wstring, wkerning>;
+    using waccelerated_smushed = basic_accelerated_style<std::wstring, wsmushed>;
+
     // flf Font Parser using std::wstring
     using wflf_font   =   basic_flf_font<std::wstring>;
 
+    // Compiled Font using std::wstring
+    using wcompiled_font  =   basic_compiled_font<std::wstring>;
+
+    // Font Registry using std::wstring
+    using wfont_registry  =   basic_font_registry<std::wstring>;
+
     // Figlet Driver using std::wstring
     using wfiglet     =   basic_figlet<std::wstring>;
+
+    // Figlet Driver with statistics using std::wstring
+    using winstrumented_figlet = basic_figlet<std::wstring, stats_instrument>;
+
+    // Render Batch using std::wstring
+    using wrender_batch   =   basic_render_batch<std::wstring>;
+
+    // Streaming Figlet using std::wstring
+    using wfiglet_stream  =   basic_figlet_stream<std::wstring>;
+
+    // Render Cache using std::wstring
+    using wrender_cache   =   basic_render_cache<std::wstring>;
+
+    /**
+     * @brief Types using std::pmr::string, buffers and results allocate
+     * from the memory resource of their allocator
+     */
+    namespace pmr
+    {
+      // Styles for the Figlet using std::pmr::string
+      using full_width  =   basic_full_width_style<std::pmr::string>;
+      using kerning     =   basic_kerning_style<std::pmr::string>;
+      using smushed     =   basic_smushed_style<std::pmr::string>;
+
+      // Styles with precomputed pairs using std::pmr::string
+      using accelerated_kerning = basic_accelerated_style<std::pmr::string, kerning>;
+      using accelerated_smushed = basic_accelerated_style<std::pmr::string, smushed>;
+
+      // flf Font Parser using std::pmr::string
+      using flf_font    =   basic_flf_font<std::pmr::string>;
+
+      // Figlet Driver using std::pmr::string
+      using figlet      =   basic_figlet<std::pmr::string>;
+
+      // Render Buffer using std::pmr::string
+      using render_buffer   =   basic_render_buffer<std::pmr::string>;
+
+      // Streaming Figlet using std::pmr::string
+      using figlet_stream   =   basic_figlet_stream<std::pmr::string>;
+
+      // Render Cache using std::pmr::string
+      using render_cache    =   basic_render_cache<std::pmr::string>;
+    }
   }
 }
 
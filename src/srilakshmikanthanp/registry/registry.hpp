@@ -0,0 +1,383 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Header Guard
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_REGISTRY_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_REGISTRY_HPP
+
+#include "../fonts/fonts.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Counters of the font registry
+     */
+    struct font_registry_stats
+    {
+      std::uint64_t hits;                         // get served by a loaded font
+      std::uint64_t misses;                       // get that parsed the font
+      std::uint64_t evictions;                    // fonts dropped for the memory limit
+      std::size_t memory_usage;                   // bytes used by the loaded fonts
+      std::chrono::nanoseconds load_time;         // time spent parsing fonts
+    };
+
+    /**
+     * @brief Thread safe registry of flf fonts loaded on first use
+     *
+     * @details fonts are kept by their canonical path, so a name and every
+     * spelling of the path of a font get the same instance
+     */
+    template <class string_type_t>
+    class basic_font_registry
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+
+      using font_type        =   basic_flf_font<string_type_t>;           // Font Type
+      using font_ptr         =   std::shared_ptr<font_type>;              // Font Pointer
+
+    private:                                                              // Private types definition
+      /**
+       * @brief Registered font
+       */
+      struct entry_type
+      {
+        std::string path;                                                 // path of the font
+        std::mutex load_mutex;                                            // serializes the parsing
+        font_ptr font;                                                    // font owned by the registry
+        std::weak_ptr<font_type> shared;                                  // font still used by others
+        std::size_t memory_usage = 0;                                     // bytes used by the font
+        std::uint64_t last_use = 0;                                       // tick of the last use
+      };
+
+    private:                                                              // Private members
+      mutable std::mutex mutex;                                           // guards the members
+      std::map<std::string, std::unique_ptr<entry_type>> entries;         // registered fonts by canonical path
+      std::map<std::string, std::string> names;                           // canonical path of the names
+      std::size_t memory_limit = std::numeric_limits<std::size_t>::max(); // limit of loaded fonts
+      std::uint64_t tick = 0;                                             // use counter
+      font_registry_stats stats = {};                                     // counters
+
+    private:                                                              // Private utilities
+      /**
+       * @brief Check the header line of the font file
+       */
+      static bool is_flf_font(const std::string &path)
+      {
+        // file stream
+        std::ifstream ifs(path);
+
+        // header line
+        std::string header;
+
+        // check
+        return std::getline(ifs, header) && header.compare(0, 5, "flf2a") == 0;
+      }
+
+      /**
+       * @brief Get the canonical path of the font file (the path as it is if
+       * it cannot be made canonical)
+       */
+      static std::string canonical_path(const std::string &path)
+      {
+        // error of the file system
+        std::error_code ec;
+
+        // canonical path
+        const auto canonical = std::filesystem::weakly_canonical(path, ec);
+
+        // return
+        return ec ? path : canonical.string();
+      }
+
+      /**
+       * @brief Get the entry of the canonical path, registered if new (locked)
+       */
+      entry_type *path_entry(const std::string &path)
+      {
+        // entry of the font
+        auto &entry = this->entries[path];
+
+        // register
+        if (!entry)
+        {
+          entry = std::make_unique<entry_type>();
+          entry->path = path;
+        }
+
+        // return
+        return entry.get();
+      }
+
+      /**
+       * @brief Find the entry or register the key as path (locked)
+       */
+      entry_type *find_entry(const std::string &key)
+      {
+        // find by name
+        if (const auto itr = this->names.find(key); itr != this->names.end())
+        {
+          return this->entries.at(itr->second).get();
+        }
+
+        // find by path
+        const auto path = canonical_path(key);
+
+        if (const auto itr = this->entries.find(path); itr != this->entries.end())
+        {
+          return itr->second.get();
+        }
+
+        // not a font file
+        if (!std::filesystem::is_regular_file(path))
+        {
+          throw std::runtime_error("Font not found : " + key);
+        }
+
+        // register by path
+        return this->path_entry(path);
+      }
+
+      /**
+       * @brief Use the loaded font of the entry if any (locked)
+       */
+      font_ptr use_entry(entry_type &entry)
+      {
+        // font that is evicted but still in use
+        if (!entry.font)
+        {
+          entry.font = entry.shared.lock();
+          entry.memory_usage = entry.font ? entry.font->get_memory_usage() : 0;
+          this->stats.memory_usage += entry.memory_usage;
+          this->evict(&entry);
+        }
+
+        // update the last use
+        if (entry.font)
+        {
+          entry.last_use = ++this->tick;
+        }
+
+        // return
+        return entry.font;
+      }
+
+      /**
+       * @brief Evict least recently used fonts above the memory limit (locked)
+       */
+      void evict(const entry_type *keep)
+      {
+        while (this->stats.memory_usage > this->memory_limit)
+        {
+          // least recently used font
+          entry_type *lru = nullptr;
+
+          for (auto &[path, entry] : this->entries)
+          {
+            if (entry->font && entry.get() != keep && (lru == nullptr || entry->last_use < lru->last_use))
+            {
+              lru = entry.get();
+            }
+          }
+
+          // nothing to evict
+          if (lru == nullptr)
+          {
+            return;
+          }
+
+          // drop the font
+          this->stats.memory_usage -= lru->memory_usage;
+          this->stats.evictions += 1;
+          lru->font.reset();
+          lru->memory_usage = 0;
+        }
+      }
+
+    public:                                                               // Public constructors
+      basic_font_registry() = default;                                    // default constructor
+      basic_font_registry(const basic_font_registry &) = delete;          // copy constructor
+
+    public:                                                               // Public methods
+      /**
+       * @brief Register the font file by name
+       */
+      void add(const std::string &name, const std::string &path)
+      {
+        // canonical path of the font
+        const auto canonical = canonical_path(path);
+
+        // lock
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        // register the name once, the path shares the entry
+        if (this->names.emplace(name, canonical).second)
+        {
+          this->path_entry(canonical);
+        }
+      }
+
+      /**
+       * @brief Register every flf font in the directory by file name (without extension)
+       *
+       * @details only the header line of the fonts are read
+       */
+      void index(const std::string &dir)
+      {
+        for (const auto &entry : std::filesystem::directory_iterator(dir))
+        {
+          if (entry.path().extension() == ".flf" && is_flf_font(entry.path().string()))
+          {
+            this->add(entry.path().stem().string(), entry.path().string());
+          }
+        }
+      }
+
+      /**
+       * @brief Get the font by name or path, the font is parsed on the first use
+       */
+      font_ptr get(const std::string &key)
+      {
+        // entry of the font
+        entry_type *entry = nullptr;
+
+        // find the loaded font
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+
+          entry = this->find_entry(key);
+
+          if (auto font = this->use_entry(*entry))
+          {
+            this->stats.hits += 1;
+            return font;
+          }
+        }
+
+        // only one thread parse the font
+        std::lock_guard<std::mutex> load_lock(entry->load_mutex);
+
+        // loaded by other thread
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+
+          if (auto font = this->use_entry(*entry))
+          {
+            this->stats.hits += 1;
+            return font;
+          }
+        }
+
+        // parse the font
+        const auto start = std::chrono::steady_clock::now();
+        const auto font = font_type::make_shared(entry->path);
+        const auto end = std::chrono::steady_clock::now();
+
+        // register the font
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        entry->font = font;
+        entry->shared = font;
+        entry->memory_usage = font->get_memory_usage();
+        entry->last_use = ++this->tick;
+
+        this->stats.misses += 1;
+        this->stats.memory_usage += entry->memory_usage;
+        this->stats.load_time += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start);
+
+        // keep under the memory limit
+        this->evict(entry);
+
+        // return
+        return font;
+      }
+
+      /**
+       * @brief Check the font is registered by name or path
+       */
+      bool contains(const std::string &key) const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->names.count(key) != 0 || this->entries.count(canonical_path(key)) != 0;
+      }
+
+      /**
+       * @brief Get the names of the registered fonts
+       */
+      std::vector<std::string> get_names() const
+      {
+        // lock
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        // names
+        std::vector<std::string> names;
+
+        for (const auto &[name, path] : this->names)
+        {
+          names.push_back(name);
+        }
+
+        return names;
+      }
+
+      /**
+       * @brief Set the memory limit of the loaded fonts in bytes
+       */
+      void set_memory_limit(std::size_t limit)
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->memory_limit = limit;
+        this->evict(nullptr);
+      }
+
+      /**
+       * @brief Get the memory limit of the loaded fonts in bytes
+       */
+      std::size_t get_memory_limit() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->memory_limit;
+      }
+
+      /**
+       * @brief Get the counters of the registry
+       */
+      font_registry_stats get_stats() const
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->stats;
+      }
+
+    public: // static methods
+      /**
+       * @brief Get the process wide registry
+       */
+      static basic_font_registry &instance()
+      {
+        static basic_font_registry registry;
+        return registry;
+      }
+    };
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_REGISTRY_HPP
@@ -0,0 +1,352 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+// Header Guard
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_STREAM_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_STREAM_HPP
+
+#include "../driver/driver.hpp"
+#include "../types/types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Streaming figlet renderer, text is written in chunks of any size
+     * and word wrapped at the output width (like figlet -w)
+     *
+     * @details each FIGline is rendered and written to the output stream as
+     * soon as it is complete, only the text of the current output line is
+     * kept so the memory is bounded by one output line whatever the size of
+     * the input. New line of the input ends the FIGline, tab is a space and
+     * carriage return is ignored. A word wider than the output width is
+     * broken at the width, a single fig char wider than the width is written
+     * as it is. A FIGline that fails with the missing glyph policy is not
+     * written and its error is kept by the stream (get_error), the output
+     * stream is left usable for the next FIGlines. It fails as soon as the
+     * missing fig char is added, the rest of its word is dropped with it and
+     * the next word starts a new FIGline.
+     */
+    template <class string_type_t, class instrument_type_t = no_instrument>
+    class basic_figlet_stream
+    {
+    public:                                                               // public type definition
+      using string_type      =   string_type_t;                           // String Type
+      using char_type        =   typename string_type_t::value_type;      // Character Type
+      using traits_type      =   typename string_type_t::traits_type;     // Traits Type
+      using size_type        =   typename string_type_t::size_type;       // Size Type
+
+      using string_view_type   =  std::basic_string_view<char_type, traits_type>;     // String View Type
+      using figlet_type        =  basic_figlet<string_type_t, instrument_type_t>;     // Figlet Type
+      using render_buffer_type =  basic_render_buffer<string_type_t>;                 // Render buffer
+
+    private:                                                              // private typedefs
+      using ostream_type     =   std::basic_ostream<char_type, traits_type>;   // Ostream Type
+      using istream_type     =   std::basic_istream<char_type, traits_type>;   // Istream Type
+
+    private:                                                              // Private constants
+      static constexpr size_type chunk_size = 4096;                       // chars read at once
+
+    private:                                                              // Private members
+      figlet_type figlet;                                                 // Figlet of the stream
+      ostream_type &out;                                                  // Output stream
+      size_type width;                                                    // Output width
+      string_type line;                                                   // Text of the FIGline
+      render_buffer_type buffer;                                          // Buffers of the render
+      std::error_code error;                                              // Error of the last failed FIGline
+      bool dropping = false;                                              // Rest of the word of a dropped FIGline
+
+    private:                                                              // Private utilities
+      /**
+       * @brief Get the size of the last code point of the line, zero while
+       * its UTF-8 sequence is not complete
+       */
+      size_type last_code_size() const
+      {
+        // code point is the character
+        if constexpr (sizeof(char_type) != 1)
+        {
+          return 1;
+        }
+        else
+        {
+          // start of the sequence
+          auto start = this->line.size() - 1;
+
+          while (start > 0 && this->line.size() - start < 4 && (to_code(this->line[start]) & 0xC0) == 0x80)
+          {
+            --start;
+          }
+
+          // length of the sequence from the lead
+          const auto lead = to_code(this->line[start]);
+          const size_type length = lead >= 0xF0 && lead < 0xF8 ? 4 : lead >= 0xE0 && lead < 0xF0 ? 3 : lead >= 0xC0 && lead < 0xE0 ? 2 : 1;
+
+          // return
+          return this->line.size() - start < length ? 0 : this->line.size() - start;
+        }
+      }
+
+      /**
+       * @brief Check the text fits in the output width
+       *
+       * @param ec invalid_argument if the text fails with the missing glyph policy
+       */
+      bool is_fit(string_view_type text, std::error_code &ec)
+      {
+        return this->figlet.measure(text, this->buffer, ec).width <= this->width;
+      }
+
+      /**
+       * @brief Render the text and write the FIGline to the output, a FIGline
+       * that fails with the missing glyph policy is not written and its
+       * error is kept
+       */
+      void write_line(string_view_type text)
+      {
+        // trailing spaces are not rendered
+        while (!text.empty() && text.back() == ' ')
+        {
+          text.remove_suffix(1);
+        }
+
+        // rows of the FIGline
+        std::error_code ec;
+        const auto &rows = this->figlet.render(text, this->buffer, ec);
+
+        if (ec)
+        {
+          this->error = ec;
+          return;
+        }
+
+        // rows with new line
+        for (const auto &fig : rows)
+        {
+          this->out.write(fig.data(), static_cast<std::streamsize>(fig.size()));
+          this->out.put(traits_type::to_char_type('\n'));
+        }
+      }
+
+      /**
+       * @brief Add the character to the FIGline, the FIGline is written
+       * when the code point does not fit
+       */
+      void put(char_type ch)
+      {
+        // rest of the word of the dropped FIGline
+        if (this->dropping)
+        {
+          this->dropping = ch != ' ';
+          return;
+        }
+
+        // add the character
+        this->line.push_back(ch);
+
+        // size of the last code point
+        const auto size = this->last_code_size();
+
+        // inside a UTF-8 sequence or only code point of the line
+        if (size == 0 || this->line.size() == size)
+        {
+          return;
+        }
+
+        // a FIGline that cannot be rendered is dropped with the rest of its
+        // word and a new one is started, so the line stays bounded by the width
+        std::error_code ec;
+        const auto fit = this->is_fit(this->line, ec);
+
+        if (ec)
+        {
+          this->error = ec;
+          this->dropping = ch != ' ';
+          this->line.clear();
+          return;
+        }
+
+        // fits in the width
+        if (fit)
+        {
+          return;
+        }
+
+        // remove the code point
+        const auto code = this->line.substr(this->line.size() - size);
+        this->line.resize(this->line.size() - size);
+
+        // break at the space
+        if (ch == ' ')
+        {
+          this->write_line(this->line);
+          this->line.clear();
+          return;
+        }
+
+        // break at the last space or at the width
+        const auto space = this->line.rfind(traits_type::to_char_type(' '));
+
+        if (space == string_type::npos)
+        {
+          this->write_line(this->line);
+          this->line.clear();
+        }
+        else
+        {
+          this->write_line(string_view_type(this->line).substr(0, space));
+          this->line.erase(0, space + 1);
+        }
+
+        // add to the next line
+        this->line += code;
+
+        // rest of the word is too wide for the next line
+        if (this->line.size() > code.size() && !this->is_fit(this->line, ec))
+        {
+          this->line.resize(this->line.size() - code.size());
+          this->write_line(this->line);
+          this->line = code;
+        }
+      }
+
+    public:                                                               // Public constructors
+      basic_figlet_stream() = delete;                                     // default constructor
+      basic_figlet_stream(const basic_figlet_stream &) = delete;          // copy constructor
+
+      /**
+       * @brief Construct a new figlet stream
+       *
+       * @param figlet figlet to render with
+       * @param out stream to write the FIGlines
+       * @param width output width
+       */
+      basic_figlet_stream(const figlet_type &figlet, ostream_type &out, size_type width = 80)
+        : figlet(figlet), out(out), width(width)
+      {
+      }
+
+      /**
+       * @brief Write the pending FIGline on destruction
+       */
+      ~basic_figlet_stream()
+      {
+        try
+        {
+          this->flush();
+        }
+        catch (...)
+        {
+          // destructor must not throw
+        }
+      }
+
+    public:                                                               // Public methods
+      /**
+       * @brief Write a chunk of the text
+       */
+      void write(string_view_type text)
+      {
+        for (const auto ch : text)
+        {
+          switch (ch)
+          {
+            case '\n':
+              if (!this->dropping)
+              {
+                this->write_line(this->line);
+              }
+              this->dropping = false;
+              this->line.clear();
+              break;
+            case '\r':
+              break;
+            case '\t':
+              this->put(traits_type::to_char_type(' '));
+              break;
+            default:
+              this->put(ch);
+              break;
+          }
+        }
+      }
+
+      /**
+       * @brief Write the text of the input stream till the end of the stream
+       */
+      void write(istream_type &in)
+      {
+        // chunk of the input
+        std::array<char_type, chunk_size> chunk;
+
+        // read till the end
+        while (in.read(chunk.data(), chunk.size()) || in.gcount() > 0)
+        {
+          this->write(string_view_type(chunk.data(), static_cast<size_type>(in.gcount())));
+        }
+      }
+
+      /**
+       * @brief Write the pending FIGline if any
+       */
+      void flush()
+      {
+        if (!this->line.empty())
+        {
+          this->write_line(this->line);
+          this->line.clear();
+        }
+
+        this->dropping = false;
+        this->out.flush();
+      }
+
+      /**
+       * @brief Get the error of the last FIGline that failed with the missing
+       * glyph policy (empty if none failed)
+       */
+      std::error_code get_error() const
+      {
+        return this->error;
+      }
+
+      /**
+       * @brief Write the text to the stream
+       */
+      basic_figlet_stream &operator<<(string_view_type text)
+      {
+        this->write(text);
+        return *this;
+      }
+    };
+
+    /**
+     * @brief Render the input stream to the output stream word wrapped at the width
+     *
+     * @param figlet figlet to render with
+     * @param in stream of the text
+     * @param out stream to write the FIGlines
+     * @param width output width
+     */
+    template <class string_type_t, class instrument_type_t>
+    void render_stream(const basic_figlet<string_type_t, instrument_type_t> &figlet, std::basic_istream<typename string_type_t::value_type> &in, std::basic_ostream<typename string_type_t::value_type> &out, typename string_type_t::size_type width = 80)
+    {
+      basic_figlet_stream<string_type_t, instrument_type_t> stream(figlet, out, width);
+      stream.write(in);
+      stream.flush();
+    }
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_STREAM_HPP
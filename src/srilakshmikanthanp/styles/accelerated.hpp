@@ -0,0 +1,363 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_ACCELERATED_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_ACCELERATED_HPP
+
+#include "../abstract/abstract.hpp"
+#include "../types/types.hpp"
+#include "./styles.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Figlet kerning or smushed style with the overlap of every pair of
+     * fig chars of a font precomputed
+     *
+     * @details the overlap of two fig chars depends only on the two chars as
+     * long as the blank rows of the left char (rows without a non space
+     * character) have more trailing spaces than the overlap, the table is
+     * used only then and the base style is used otherwise. The output is the
+     * same as the base style.
+     */
+    template <class string_type_t, class base_style_t = basic_smushed_style<string_type_t>>
+    struct basic_accelerated_style : public base_style_t
+    {
+    public:                                                          // public type definition
+      using string_type   = string_type_t;                           // String Type
+      using char_type     = typename string_type_t::value_type;      // Character Type
+      using traits_type   = typename string_type_t::traits_type;     // Traits Type
+      using size_type     = typename string_type_t::size_type;       // Size Type
+      using allocator_type = typename string_type_t::allocator_type; // Allocator Type
+
+      using fig_char_type = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type  = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   = std::basic_string_view<char_type, traits_type>;       // String View Type
+      using fig_char_view_type = basic_fig_char_view<char_type, traits_type>;          // Figlet char view
+      using fig_char_rows_type = basic_alloc_vector<string_type_t, string_view_type>;  // Figlet char rows
+      using fig_edges_type     = basic_alloc_vector<string_type_t, size_type>;         // Edge spaces of rows
+      using fig_params_type    = basic_fig_params<char_type>;                          // Figlet params
+      using fig_grid_type      = basic_fig_grid<string_type_t>;                        // Figlet grid
+      using render_buffer_type = basic_render_buffer<string_type_t>;                   // Render buffer
+
+      using base_style_type      = base_style_t;                                  // Base Style Type
+      using base_figlet_font_ptr = std::shared_ptr<basic_base_figlet_font<string_type>>;
+
+      static_assert(std::is_base_of_v<basic_kerning_style<string_type_t>, base_style_t>, "base style must be kerning or smushed");
+
+    private:                                                         // private constants
+      static constexpr bool is_smushed = std::is_base_of_v<basic_smushed_style<string_type_t>, base_style_t>;
+
+      static constexpr char_type first_char = ' ';                   // first fig char
+      static constexpr char_type last_char  = '~';                   // last fig char
+      static constexpr size_type count = last_char - first_char + 1; // number of fig chars
+      static constexpr size_type npos = size_type(-1);               // not a fig char of the font
+
+    private:                                                         // private types
+      /**
+       * @brief Overlap of a pair of fig chars
+       */
+      struct pair_type
+      {
+        std::uint32_t amount;                                        // overlap of the non blank rows
+        bool smush;                                                  // boundary is smushed
+      };
+
+    private:                                                         // private members
+      base_figlet_font_ptr font;                                     // font of the table
+      fig_params_type params;                                        // parameters of the font
+      basic_alloc_vector<string_type_t, fig_char_view_type> views;   // fig chars of the font
+      basic_alloc_vector<string_type_t, pair_type> pairs;            // count x count pairs
+      string_type smushes;                                           // smushed boundary of each pair
+
+    private:                                                         // private utilities
+      /**
+       * @brief Get the index of the fig char in the table or npos
+       */
+      size_type index_of(const fig_char_view_type &fig_chr) const
+      {
+        // address of the row tables
+        const auto base = reinterpret_cast<std::uintptr_t>(this->views.front().data());
+        const auto addr = reinterpret_cast<std::uintptr_t>(fig_chr.data());
+        const auto step = this->views.front().size() * sizeof(fig_row_type);
+
+        // not in the row table of the font
+        if (addr < base || step == 0 || (addr - base) % step != 0 || (addr - base) / step >= count)
+        {
+          return npos;
+        }
+
+        // index of the fig char
+        const auto index = (addr - base) / step;
+
+        // return
+        return this->views[index].data() == fig_chr.data() ? index : npos;
+      }
+
+      /**
+       * @brief Compute the overlap of the pair with the base style
+       */
+      void make_pair(size_type lhs, size_type rhs)
+      {
+        // left fig char as fig str
+        fig_grid_type fig_str(this->smushes.get_allocator());
+        fig_edges_type trails(this->params.height, this->smushes.get_allocator());
+        fig_char_rows_type fig_rows(this->params.height, this->smushes.get_allocator());
+
+        // pair of the table
+        auto &pair = this->pairs[lhs * count + rhs];
+
+        // overlap of the non blank rows
+        std::uint32_t amount = std::numeric_limits<std::uint32_t>::max();
+
+        for (size_type i = 0; i < this->params.height; ++i)
+        {
+          if (this->views[lhs].trail(i) < this->views[lhs][i].size())
+          {
+            amount = std::min<std::uint32_t>(amount, this->views[lhs].trail(i) + this->views[rhs].lead(i));
+          }
+        }
+
+        pair.amount = amount;
+        pair.smush = false;
+
+        // blank left char is never in the table
+        if (amount == std::numeric_limits<std::uint32_t>::max())
+        {
+          return;
+        }
+
+        // widest row of the left fig char, only kerned
+        size_type width = amount + 1;
+
+        for (size_type i = 0; i < this->params.height; ++i)
+        {
+          width = std::max<size_type>(width, this->views[lhs][i].size());
+        }
+
+        fig_str.reset(this->params.height, width);
+
+        // blank rows have more trailing spaces than the overlap
+        for (size_type i = 0; i < this->params.height; ++i)
+        {
+          if (this->views[lhs].trail(i) < this->views[lhs][i].size())
+          {
+            fig_str[i].assign(this->views[lhs][i]);
+            trails[i] = this->views[lhs].trail(i);
+          }
+          else
+          {
+            fig_str[i].assign(amount + 1, traits_type::to_char_type(' '));
+            trails[i] = amount + 1;
+          }
+        }
+
+        // kern the pair
+        this->trim_fig_str_and_fig_char(fig_str, trails, this->views[rhs], fig_rows);
+
+        // smush the pair
+        if constexpr (is_smushed)
+        {
+          pair.smush = this->is_smushable(this->params, fig_str, fig_rows);
+
+          for (size_type i = 0; i < this->params.height && pair.smush; ++i)
+          {
+            this->smushes[(lhs * count + rhs) * this->params.height + i] = this->smush_rules(this->params, fig_str[i].back(), fig_rows[i].front());
+          }
+        }
+      }
+
+      /**
+       * @brief Kern (and smush) the fig char with the pair of the table
+       */
+      void join_pair(fig_grid_type &fig_str, fig_edges_type &trails, size_type index, const fig_char_view_type &fig_chr, fig_char_rows_type &fig_rows) const
+      {
+        // pair of the table
+        const auto &pair = this->pairs[index];
+
+        // kern
+        for (size_type i = 0; i < this->params.height; ++i)
+        {
+          const auto pop = std::min<size_type>(pair.amount, trails[i]);
+
+          fig_str[i].resize(fig_str[i].size() - pop);
+          trails[i] -= pop;
+
+          fig_rows[i] = fig_chr[i];
+          fig_rows[i].remove_prefix(std::min(pair.amount - pop, fig_rows[i].size()));
+        }
+
+        // not smushed
+        if (!pair.smush)
+        {
+          return;
+        }
+
+        // smush
+        for (size_type i = 0; i < this->params.height; ++i)
+        {
+          fig_str[i].back() = this->smushes[index * this->params.height + i];
+          fig_rows[i].remove_prefix(1);
+
+          if (fig_str[i].back() != ' ')
+          {
+            trails[i] = 0;
+          }
+        }
+      }
+
+      /**
+       * @brief Update the trailing spaces of the fig str with the added rows
+       *
+       * @return minimum trailing spaces of the blank rows of the fig char or
+       * zero when a non blank row lost all its non space characters
+       */
+      size_type update_boundary(fig_edges_type &trails, const fig_char_view_type &fig_chr, const fig_char_rows_type &fig_rows) const
+      {
+        // minimum trailing spaces of the blank rows
+        auto blank = std::numeric_limits<size_type>::max();
+
+        for (size_type i = 0; i < this->params.height; ++i)
+        {
+          // row ends with a non space character of the fig char
+          if (fig_chr.trail(i) < fig_rows[i].size())
+          {
+            trails[i] = fig_chr.trail(i);
+            continue;
+          }
+
+          // row is all spaces
+          trails[i] += fig_rows[i].size();
+
+          // non blank row lost its non space characters to the smush
+          if (fig_chr.trail(i) < fig_chr[i].size())
+          {
+            blank = 0;
+          }
+          else
+          {
+            blank = std::min(blank, trails[i]);
+          }
+        }
+
+        return blank;
+      }
+
+    public:                                                          // public constructors
+      basic_accelerated_style() = delete;                            // default constructor
+
+      /**
+       * @brief Construct the style and precompute the pairs of the font
+       *
+       * @param font font of the table
+       * @param alloc allocator of the table
+       */
+      explicit basic_accelerated_style(base_figlet_font_ptr font, const allocator_type &alloc = allocator_type())
+        : font(font), params(font->get_params()), views(alloc), pairs(alloc), smushes(alloc)
+      {
+        // fig chars of the font
+        for (char_type ch = first_char; ch <= last_char; ++ch)
+        {
+          this->views.push_back(font->get_fig_char_view(ch));
+        }
+
+        // tables
+        this->pairs.resize(count * count);
+
+        if constexpr (is_smushed)
+        {
+          this->smushes.resize(count * count * this->params.height);
+        }
+
+        for (size_type lhs = 0; lhs < count; ++lhs)
+        {
+          for (size_type rhs = 0; rhs < count; ++rhs)
+          {
+            this->make_pair(lhs, rhs);
+          }
+        }
+      }
+
+    public:                                                          // public overrides
+      /**
+       * @brief Render the Fig string, the pairs are used only with the
+       * parameters of the font of the table
+       */
+      void render_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
+      {
+        // other font
+        if (params.hard_blank != this->params.hard_blank || params.height != this->params.height || params.layout != this->params.layout)
+        {
+          return base_style_t::render_fig_str(params, buffer);
+        }
+
+        // fig str, rows of the fig char and trailing spaces
+        auto &fig_str = buffer.fig_str;
+        auto &fig_rows = buffer.fig_rows;
+        auto &trails = buffer.trails;
+
+        // clear the buffer
+        this->clear_buffer(params, buffer);
+
+        // verify the height
+        this->verify_height(params, buffer.fig_chs);
+
+        // index of the last fig char and trailing spaces of its blank rows
+        size_type last = npos, blank = 0;
+
+        for (const auto &fig_chr : buffer.fig_chs)
+        {
+          const auto index = this->index_of(fig_chr);
+
+          if (last != npos && index != npos && blank > this->pairs[last * count + index].amount)
+          {
+            this->join_pair(fig_str, trails, last * count + index, fig_chr, fig_rows);
+          }
+          else
+          {
+            this->trim_fig_str_and_fig_char(fig_str, trails, fig_chr, fig_rows);
+
+            if constexpr (is_smushed)
+            {
+              this->smush_fig_str_and_fig_char(params, fig_str, trails, fig_rows);
+            }
+          }
+
+          this->add_fig_str_and_fig_char(fig_str, fig_rows);
+
+          // boundary of the next pair
+          blank = this->update_boundary(trails, fig_chr, fig_rows);
+          last = index;
+        }
+
+        // remove hardblank
+        this->rm_hardblank(params, fig_str);
+      }
+
+    public:                                                          // static methods
+      /**
+       * @brief Make a accelerated style of the font as shared pointer
+       */
+      static auto make_shared(base_figlet_font_ptr font, const allocator_type &alloc = allocator_type())
+      {
+        return std::make_shared<basic_accelerated_style>(font, alloc);
+      }
+    };
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_ACCELERATED_HPP
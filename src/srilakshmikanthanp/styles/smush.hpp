@@ -0,0 +1,220 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SRILAKSHMIKANTHANP_LIBFIGLET_SMUSH_HPP
+#define SRILAKSHMIKANTHANP_LIBFIGLET_SMUSH_HPP
+
+#include "../types/types.hpp"
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Hierarchy class of the character (0 is not in the hierarchy)
+     */
+    constexpr int smush_class(std::uint32_t ch)
+    {
+      switch (ch)
+      {
+        case '|':
+          return 1;
+        case '/': case '\\':
+          return 2;
+        case '[': case ']':
+          return 3;
+        case '{': case '}':
+          return 4;
+        case '(': case ')':
+          return 5;
+        case '<': case '>':
+          return 6;
+        default:
+          return 0;
+      }
+    }
+
+    /**
+     * @brief Smush two character codes with the horizontal layout
+     *
+     * @details rules of the FIGfont 2 specification, controlled smushing
+     * applies the rule bits of the layout and universal smushing (no rule
+     * bits) keeps the later character.
+     *
+     * @param lc left character
+     * @param rc right character
+     * @param hb hard blank
+     * @param layout horizontal layout
+     *
+     * @return smushed character or 0 if the characters do not smush
+     */
+    constexpr std::uint32_t smush_chars(std::uint32_t lc, std::uint32_t rc, std::uint32_t hb, layout_type layout)
+    {
+      //()
+      if (lc == ' ')
+      {
+        return rc;
+      }
+
+      if (rc == ' ')
+      {
+        return lc;
+      }
+
+      //(Universal smush)
+      if ((layout & fig_layout::RULES) == 0)
+      {
+        return lc == hb ? rc : (rc == hb ? lc : rc);
+      }
+
+      //(Hardblank smush)
+      if (lc == hb || rc == hb)
+      {
+        return (layout & fig_layout::HARD_BLANK) && lc == rc ? lc : 0;
+      }
+
+      //(Equal character smush)
+      if ((layout & fig_layout::EQUAL) && lc == rc)
+      {
+        return lc;
+      }
+
+      //(Underscores smush)
+      if ((layout & fig_layout::UNDERSCORE) && lc == '_' && smush_class(rc) != 0)
+      {
+        return rc;
+      }
+
+      if ((layout & fig_layout::UNDERSCORE) && rc == '_' && smush_class(lc) != 0)
+      {
+        return lc;
+      }
+
+      //(Hierarchy Smushing)
+      if ((layout & fig_layout::HIERARCHY) && smush_class(lc) != 0 && smush_class(rc) != 0 && smush_class(lc) != smush_class(rc))
+      {
+        return smush_class(lc) > smush_class(rc) ? lc : rc;
+      }
+
+      //(Opposite smush) brackets of the same class
+      if ((layout & fig_layout::OPPOSITE) && lc != rc && smush_class(lc) == smush_class(rc) && smush_class(lc) >= 3 && smush_class(lc) <= 5)
+      {
+        return '|';
+      }
+
+      //(Big X smush)
+      if ((layout & fig_layout::BIG_X) && lc == '/' && rc == '\\')
+      {
+        return '|';
+      }
+
+      if ((layout & fig_layout::BIG_X) && lc == '\\' && rc == '/')
+      {
+        return 'Y';
+      }
+
+      if ((layout & fig_layout::BIG_X) && lc == '>' && rc == '<')
+      {
+        return 'X';
+      }
+
+      // not smushed
+      return 0;
+    }
+
+    /**
+     * @brief Table of the controlled smushing rules over the printable ascii characters
+     *
+     * @details every pair of characters is smushed by one rule at most, so the
+     * table keeps the rule and the smushed character of each pair and a
+     * layout is applied with a single mask, rules not in the layout are never
+     * tested.
+     */
+    struct smush_table
+    {
+      static constexpr std::uint32_t first = ' ';                       // first character
+      static constexpr std::uint32_t count = '~' - ' ' + 1;             // number of characters
+
+      /**
+       * @brief Smush of a pair of characters
+       */
+      struct entry_type
+      {
+        std::uint8_t rule;                                              // rule of the pair (0 is none)
+        char smush;                                                     // smushed character
+      };
+
+      std::array<entry_type, count * count> entries;                    // pairs
+
+      /**
+       * @brief Build the table at compile time
+       */
+      constexpr smush_table() : entries{}
+      {
+        for (std::uint32_t lc = 0; lc < count; ++lc)
+        {
+          for (std::uint32_t rc = 0; rc < count; ++rc)
+          {
+            for (layout_type rule = fig_layout::EQUAL; rule < fig_layout::HARD_BLANK; rule <<= 1)
+            {
+              if (const auto smush = smush_chars(lc + first, rc + first, 0, rule); smush != 0)
+              {
+                this->entries[lc * count + rc] = {static_cast<std::uint8_t>(rule), static_cast<char>(smush)};
+              }
+            }
+          }
+        }
+      }
+
+      /**
+       * @brief Smush two characters with the layout
+       *
+       * @return smushed character or 0 if the characters do not smush
+       */
+      template <class char_type_t, class traits_type_t = std::char_traits<char_type_t>>
+      constexpr char_type_t operator()(char_type_t lc, char_type_t rc, char_type_t hb, layout_type layout) const
+      {
+        // character codes
+        const auto l = static_cast<std::uint32_t>(traits_type_t::to_int_type(lc));
+        const auto r = static_cast<std::uint32_t>(traits_type_t::to_int_type(rc));
+        const auto h = static_cast<std::uint32_t>(traits_type_t::to_int_type(hb));
+
+        //()
+        if (l == ' ')
+        {
+          return rc;
+        }
+
+        if (r == ' ')
+        {
+          return lc;
+        }
+
+        // printable ascii from the table
+        if (l - first < count && r - first < count && l != h && r != h && (layout & fig_layout::RULES))
+        {
+          const auto &entry = this->entries[(l - first) * count + (r - first)];
+          return (entry.rule & layout) ? traits_type_t::to_char_type(entry.smush) : char_type_t();
+        }
+
+        // other characters
+        const auto smush = smush_chars(l, r, h, layout);
+
+        return smush == l ? lc : (smush == r ? rc : traits_type_t::to_char_type(static_cast<typename traits_type_t::int_type>(smush)));
+      }
+    };
+
+    /**
+     * @brief Smush table of the smushed style
+     */
+    inline constexpr smush_table smush_rules_table{};
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_LIBFIGLET_SMUSH_HPP
@@ -8,18 +8,21 @@
 
 #include "../abstract/abstract.hpp"
 #include "../utility/functions.hpp"
+#include "../utility/simd.hpp"
 #include "../types/types.hpp"
+#include "./smush.hpp"
 
 #include <algorithm>
 #include <ostream>
 #include <string>
 #include <map>
 #include <iomanip>
-#include <regex>
 #include <vector>
 #include <memory>
 #include <fstream>
 #include <sstream>
+#include <string_view>
+#include <limits>
 
 namespace srilakshmikanthanp
 {
@@ -37,8 +40,15 @@ namespace srilakshmikanthanp
       using traits_type   = typename string_type_t::traits_type;    // Traits Type
       using size_type     = typename string_type_t::size_type;      // Size Type
 
-      using fig_char_type = std::vector<string_type_t>;             // Figlet char
-      using fig_str_type  = std::vector<string_type_t>;             // Figlet String
+      using fig_char_type = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type  = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   = std::basic_string_view<char_type, traits_type>;       // String View Type
+      using fig_char_view_type = basic_fig_char_view<char_type, traits_type>;          // Figlet char view
+      using fig_char_rows_type = basic_alloc_vector<string_type_t, string_view_type>;  // Figlet char rows
+      using fig_params_type    = basic_fig_params<char_type>;                          // Figlet params
+      using fig_grid_type      = basic_fig_grid<string_type_t>;                        // Figlet grid
+      using render_buffer_type = basic_render_buffer<string_type_t>;                   // Render buffer
 
     private:                                                        // private typedefs
       using sstream_type  = std::basic_stringstream<char_type>;     // Sstream Type
@@ -49,9 +59,10 @@ namespace srilakshmikanthanp
 
     protected:                                                      // Protected methods
       /**
-       * @brief Add the Fig String and the Figlet Char
+       * @brief Add the Fig String and the Figlet Char (view or rows)
        */
-      void add_fig_str_and_fig_char(fig_str_type& fig_str, const fig_char_type& fig_char) const
+      template <class fig_rows_type>
+      void add_fig_str_and_fig_char(fig_grid_type &fig_str, const fig_rows_type& fig_char) const
       {
         for (size_type i = 0; i < fig_char.size(); ++i)
         {
@@ -59,27 +70,65 @@ namespace srilakshmikanthanp
         }
       }
 
+      /**
+       * @brief Add the Fig String and the Figlet Char (view or rows) with the
+       * hard blanks replaced by spaces in the same pass
+       */
+      template <class fig_rows_type>
+      void append_fig_str_and_fig_char(const fig_params_type &params, fig_grid_type &fig_str, const fig_rows_type& fig_char) const
+      {
+        for (size_type i = 0; i < fig_char.size(); ++i)
+        {
+          const string_view_type row = fig_char[i];
+          const auto size = fig_str[i].size();
+
+          fig_str[i].resize(size + row.size());
+          copy_replace(fig_str[i].data() + size, row.data(), row.size(), params.hard_blank, traits_type::to_char_type(' '));
+        }
+      }
+
     public:                                                         // public methods
       /**
-       * @brief get the fig str
+       * @brief render the fig str
        */
-      fig_str_type get_fig_str(std::vector<fig_char_type> fig_chrs) const override
+      void render_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
       {
-        // fig str container type
-        fig_str_type fig_str(this->height);
+        // clear the fig str
+        this->clear_buffer(params, buffer);
 
         // verify height
-        this->verify_height(fig_chrs);
+        this->verify_height(params, buffer.fig_chs);
+
+        // for each fig char, hard blanks are replaced on the copy
+        for (const auto &fig_chr : buffer.fig_chs)
+        {
+          this->append_fig_str_and_fig_char(params, buffer.fig_str, fig_chr);
+        }
+       }
+
+      /**
+       * @brief measure the width of the fig str
+       */
+      size_type measure_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
+      {
+        // widths of the rows
+        buffer.widths.assign(params.height, 0);
+
+        // verify height
+        this->verify_height(params, buffer.fig_chs);
 
         // for each fig char
-        for (auto &fig_chr : fig_chrs)
+        for (const auto &fig_chr : buffer.fig_chs)
         {
-          this->add_fig_str_and_fig_char(fig_str, fig_chr);
+          for (size_type i = 0; i < params.height; ++i)
+          {
+            buffer.widths[i] += fig_chr[i].size();
+          }
         }
 
         // return
-        return this->rm_hardblank(fig_str);
-       }
+        return this->max_width(buffer);
+      }
 
        /**
         * @brief get shrink level
@@ -111,8 +160,16 @@ namespace srilakshmikanthanp
       using traits_type   = typename string_type_t::traits_type;     // Traits Type
       using size_type     = typename string_type_t::size_type;       // Size Type
 
-      using fig_char_type = std::vector<string_type_t>;              // Figlet char
-      using fig_str_type  = std::vector<string_type_t>;              // Figlet String
+      using fig_char_type = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type  = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   = std::basic_string_view<char_type, traits_type>;       // String View Type
+      using fig_char_view_type = basic_fig_char_view<char_type, traits_type>;          // Figlet char view
+      using fig_char_rows_type = basic_alloc_vector<string_type_t, string_view_type>;  // Figlet char rows
+      using fig_edges_type     = basic_alloc_vector<string_type_t, size_type>;         // Edge spaces of rows
+      using fig_params_type    = basic_fig_params<char_type>;                          // Figlet params
+      using fig_grid_type      = basic_fig_grid<string_type_t>;                        // Figlet grid
+      using render_buffer_type = basic_render_buffer<string_type_t>;                   // Render buffer
 
     private:                                                         // private typedefs
       using sstream_type  = std::basic_stringstream<char_type>;      // Sstream Type
@@ -123,75 +180,132 @@ namespace srilakshmikanthanp
 
     protected:                                                       // protected methods
       /**
-       * @brief Trim deep the figlet string and char
+       * @brief Get the overlap of the fig char, the minimum over the rows of
+       * the trailing spaces of the fig str and the leading spaces of the fig char
        */
-      void trim_fig_str_and_fig_char(fig_str_type &fig_str, fig_char_type &fig_chr) const
+      size_type get_overlap(const fig_edges_type &trails, const fig_char_view_type &fig_chr) const
       {
-        // left spaces and right spaces
-        std::vector<size_type> elem;
+        auto min = std::numeric_limits<size_type>::max();
 
-        // count space
-        for (size_type i = 0; i < fig_str.size(); ++i)
+        for (size_type i = 0; i < trails.size(); ++i)
         {
-          int l_count = 0, r_count = 0;
+          min = std::min(min, trails[i] + fig_chr.lead(i));
+        }
 
-          for (auto itr = fig_str[i].rbegin(); itr != fig_str[i].rend(); ++itr)
-          {
-            if (*itr == ' ')
-              ++l_count;
-            else
-              break;
-          }
+        return min;
+      }
 
-          for (auto itr = fig_chr[i].begin(); itr != fig_chr[i].end(); ++itr)
-          {
-            if (*itr == ' ')
-              ++r_count;
-            else
-              break;
-          }
+      /**
+       * @brief Kern the widths and trailing spaces of the measured rows, the
+       * rows of the fig char left after the overlap are kept in fig_rows
+       */
+      void trim_widths_and_fig_char(render_buffer_type &buffer, const fig_char_view_type &fig_chr) const
+      {
+        // overlap of the fig char
+        const auto min = this->get_overlap(buffer.trails, fig_chr);
+
+        // for each line
+        for (size_type i = 0; i < buffer.trails.size(); ++i)
+        {
+          // spaces removed from the row
+          const auto pop = std::min(min, buffer.trails[i]);
 
-          elem.push_back(l_count + r_count);
+          buffer.widths[i] -= pop;
+          buffer.trails[i] -= pop;
+
+          // rest is removed from the fig char
+          buffer.fig_rows[i] = fig_chr[i];
+          buffer.fig_rows[i].remove_prefix(std::min(min - pop, buffer.fig_rows[i].size()));
         }
+      }
 
-        // minimum
-        const auto min = *std::min_element(elem.begin(), elem.end());
+      /**
+       * @brief Trim deep the figlet string and char
+       *
+       * @details the overlap is the minimum over the rows of the trailing
+       * spaces of the fig str (trails) and the leading spaces of the fig char
+       */
+      void trim_fig_str_and_fig_char(fig_grid_type &fig_str, fig_edges_type &trails, const fig_char_view_type &fig_chr, fig_char_rows_type &fig_rows) const
+      {
+        // minimum of right spaces and left spaces
+        const auto min = this->get_overlap(trails, fig_chr);
 
         // for each line
         for (size_type i = 0; i < fig_str.size(); ++i)
         {
-          size_type siz = min + 1;
+          // spaces removed from the fig str
+          const auto pop = std::min(min, trails[i]);
 
-          while (--siz > 0 && fig_str[i].back() == ' ')
-          {
-            fig_str[i].pop_back();
-          }
+          fig_str[i].resize(fig_str[i].size() - pop);
+          trails[i] -= pop;
+
+          // rest is removed from the fig char
+          fig_rows[i] = fig_chr[i];
+          fig_rows[i].remove_prefix(std::min(min - pop, fig_rows[i].size()));
+        }
+      }
 
-          fig_chr[i].erase(0, siz);
+      /**
+       * @brief Update the trailing spaces of the fig str with the added rows
+       */
+      void update_trails(fig_edges_type &trails, const fig_char_view_type &fig_chr, const fig_char_rows_type &fig_rows) const
+      {
+        for (size_type i = 0; i < fig_rows.size(); ++i)
+        {
+          trails[i] = fig_chr.trail(i) < fig_rows[i].size() ? fig_chr.trail(i) : trails[i] + fig_rows[i].size();
         }
       }
 
     public:                                                          // Public overrides
       /**
-       * @brief get the fig str
+       * @brief render the fig str, trailing spaces are counted on the fig
+       * chars so hard blanks are replaced as the rows are added
+       */
+      void render_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
+      {
+        // clear the fig str, rows of the fig char and trailing spaces
+        this->clear_buffer(params, buffer);
+
+        // verify height
+        this->verify_height(params, buffer.fig_chs);
+
+        // for each fig char
+        for (const auto &fig_chr : buffer.fig_chs)
+        {
+          this->trim_fig_str_and_fig_char(buffer.fig_str, buffer.trails, fig_chr, buffer.fig_rows);
+          this->append_fig_str_and_fig_char(params, buffer.fig_str, buffer.fig_rows);
+          this->update_trails(buffer.trails, fig_chr, buffer.fig_rows);
+        }
+      }
+
+      /**
+       * @brief measure the width of the fig str
        */
-      fig_str_type get_fig_str(std::vector<fig_char_type> fig_chrs) const override
+      size_type measure_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
       {
-        // fig str container type
-        fig_str_type fig_str(this->height);
+        // widths and trailing spaces of the rows
+        buffer.widths.assign(params.height, 0);
+        buffer.trails.assign(params.height, 0);
+        buffer.fig_rows.resize(params.height);
 
         // verify height
-        this->verify_height(fig_chrs);
+        this->verify_height(params, buffer.fig_chs);
 
         // for each fig char
-        for (auto &fig_chr : fig_chrs)
+        for (const auto &fig_chr : buffer.fig_chs)
         {
-          this->trim_fig_str_and_fig_char(fig_str, fig_chr);
-          this->add_fig_str_and_fig_char(fig_str, fig_chr);
+          this->trim_widths_and_fig_char(buffer, fig_chr);
+
+          for (size_type i = 0; i < params.height; ++i)
+          {
+            buffer.widths[i] += buffer.fig_rows[i].size();
+          }
+
+          this->update_trails(buffer.trails, fig_chr, buffer.fig_rows);
         }
 
         // return
-        return this->rm_hardblank(fig_str);
+        return this->max_width(buffer);
       }
 
       /**
@@ -224,8 +338,16 @@ namespace srilakshmikanthanp
       using traits_type   = typename string_type_t::traits_type;     // Traits Type
       using size_type     = typename string_type_t::size_type;       // Size Type
 
-      using fig_char_type = std::vector<string_type_t>;              // Figlet char
-      using fig_str_type  = std::vector<string_type_t>;              // Figlet String
+      using fig_char_type = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet char
+      using fig_str_type  = basic_alloc_vector<string_type_t, string_type_t>;  // Figlet String
+
+      using string_view_type   = std::basic_string_view<char_type, traits_type>;       // String View Type
+      using fig_char_view_type = basic_fig_char_view<char_type, traits_type>;          // Figlet char view
+      using fig_char_rows_type = basic_alloc_vector<string_type_t, string_view_type>;  // Figlet char rows
+      using fig_edges_type     = basic_alloc_vector<string_type_t, size_type>;         // Edge spaces of rows
+      using fig_params_type    = basic_fig_params<char_type>;                          // Figlet params
+      using fig_grid_type      = basic_fig_grid<string_type_t>;                        // Figlet grid
+      using render_buffer_type = basic_render_buffer<string_type_t>;                   // Render buffer
 
     private:                                                         // private typedefs
       using sstream_type  = std::basic_stringstream<char_type>;      // Sstream Type
@@ -236,183 +358,171 @@ namespace srilakshmikanthanp
 
     protected:                                                       // protected methods
       /**
-       * @brief Smush Rules for the characters
+       * @brief Smush Rules for the characters with the layout of the font
+       *
+       * @details printable ascii pairs are looked up in the constexpr table
+       * of smush.hpp and other characters fall back to smush_chars
+       *
+       * @return smushed character or 0 if the characters do not smush
        */
-      auto smush_rules(char_type lc, char_type rc) const
+      char_type smush_rules(const fig_params_type &params, char_type lc, char_type rc) const
       {
-        //()
-        if (lc == traits_type::to_char_type(' '))
-        {
-          return rc;
-        }
-
-        if (rc == traits_type::to_char_type(' '))
-        {
-          return lc;
-        }
-
-        //(Equal character smush)
-        if (lc == rc)
-        {
-          return rc;
-        }
-
-        //(Underscores smush)
-        if (lc == traits_type::to_char_type('_') && cvt<string_type>("|/\\[]{}()<>").find(rc) != string_type::npos)
-        {
-          return rc;
-        }
-
-        if (rc == traits_type::to_char_type('_') && cvt<string_type>("|/\\[]{}()<>").find(lc) != string_type::npos)
-        {
-          return lc;
-        }
+        return smush_rules_table.operator()<char_type, traits_type>(lc, rc, params.hard_blank, params.layout);
+      }
 
-        //(Hierarchy Smushing)
-        auto find_class = [](char_type ch)
+      /**
+       * @brief Check the kerned Fig string and character can be smushed
+       */
+      bool is_smushable(const fig_params_type &params, const fig_grid_type &fig_str, const fig_char_rows_type &fig_chr) const
+      {
+        for (size_type i = 0; i < fig_str.size(); ++i)
         {
-          if (ch == traits_type::to_char_type('|'))
+          if (fig_str[i].empty() || fig_chr[i].empty())
           {
-            return 1;
+            return false;
           }
-
-          if (ch == traits_type::to_char_type('/') || ch == traits_type::to_char_type('\\'))
+          else if (this->smush_rules(params, fig_str[i].back(), fig_chr[i].front()) == char_type())
           {
-            return 3;
+            return false;
           }
+        }
 
-          if (ch == traits_type::to_char_type('[') || ch == traits_type::to_char_type(']'))
-          {
-            return 4;
-          }
+        return true;
+      }
+
+      /**
+       * @brief smush algorithm on kerned widths of the measured rows
+       */
+      void smush_widths_and_fig_char(const fig_params_type &params, render_buffer_type &buffer) const
+      {
+        // back of the row
+        const auto back = [&](size_type i) {
+          return buffer.trails[i] > 0 ? traits_type::to_char_type(' ') : buffer.backs[i];
+        };
 
-          if (ch == traits_type::to_char_type('{') || ch == traits_type::to_char_type('}'))
+        // determine if smushable if not the just return
+        for (size_type i = 0; i < buffer.widths.size(); ++i)
+        {
+          if (buffer.widths[i] == 0 || buffer.fig_rows[i].empty())
           {
-            return 5;
+            return;
           }
-
-          if (ch == traits_type::to_char_type('(') || ch == traits_type::to_char_type(')'))
+          else if (this->smush_rules(params, back(i), buffer.fig_rows[i].front()) == char_type())
           {
-            return 6;
+            return;
           }
-
-          return 0;
-        };
-
-        size_type c_lc = find_class(lc);
-        size_type c_rc = find_class(rc);
-
-        if (c_lc > c_rc)
-        {
-          return lc;
-        }
-
-        if (c_rc > c_lc)
-        {
-          return rc;
         }
 
-        //(Opposite smush)
-        if (lc == traits_type::to_char_type('[')  &&  rc == traits_type::to_char_type(']'))
+        // smush the rows and fig char
+        for (size_type i = 0; i < buffer.widths.size(); ++i)
         {
-          return traits_type::to_char_type('|');
-        }
-
-        if (lc == traits_type::to_char_type(']')  &&  rc == traits_type::to_char_type('['))
-        {
-          return traits_type::to_char_type('|');
-        }
-
-        if (lc == traits_type::to_char_type('{')  &&  rc == traits_type::to_char_type('}'))
-        {
-          return traits_type::to_char_type('|');
-        }
-
-        if (lc == traits_type::to_char_type('}')  &&  rc == traits_type::to_char_type('{'))
-        {
-          return traits_type::to_char_type('|');
-        }
+          const auto smush = this->smush_rules(params, back(i), buffer.fig_rows[i].front());
 
-        if (lc == traits_type::to_char_type('(')  &&  rc == traits_type::to_char_type(')'))
-        {
-          return traits_type::to_char_type('|');
-        }
+          buffer.fig_rows[i].remove_prefix(1);
 
-        if (lc == traits_type::to_char_type(')')  &&  rc == traits_type::to_char_type('('))
-        {
-          return traits_type::to_char_type('|');
+          // smushed character is space only if both are space
+          if (smush != ' ')
+          {
+            buffer.trails[i] = 0;
+            buffer.backs[i] = smush;
+          }
         }
+      }
 
-        //(Big X smush)
-        if (lc == traits_type::to_char_type('/')  &&  rc == traits_type::to_char_type('\\'))
+      /**
+       * @brief smush algorithm on kerned Fig string and character
+       */
+      void smush_fig_str_and_fig_char(const fig_params_type &params, fig_grid_type &fig_str, fig_edges_type &trails, fig_char_rows_type &fig_chr) const
+      {
+        // determine if smushable if not the just return
+        if (!this->is_smushable(params, fig_str, fig_chr))
         {
-          return traits_type::to_char_type('|');
+          return;
         }
 
-        if (lc == traits_type::to_char_type('\\') &&  rc == traits_type::to_char_type('/'))
+        // smush the fig str and fig char
+        for (size_type i = 0; i < fig_str.size(); ++i)
         {
-          return traits_type::to_char_type('Y');
-        }
+          fig_str[i].back() = this->smush_rules(params, fig_str[i].back(), fig_chr[i].front());
+          fig_chr[i].remove_prefix(1);
 
-        if (lc == traits_type::to_char_type('>')  &&  rc == traits_type::to_char_type('<'))
-        {
-          return traits_type::to_char_type('X');
+          // smushed character is space only if both are space
+          if (fig_str[i].back() != ' ')
+          {
+            trails[i] = 0;
+          }
         }
-
-        //(universal smush)
-        return lc;
       }
 
+    public:                                                            // public methods
       /**
-       * @brief smush algorithm on kerned Fig string and character
+       * @brief Render the Fig string
        */
-      void smush_fig_str_and_fig_char(fig_str_type &fig_str, fig_char_type fig_chr) const
+      void render_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
       {
-        // determine if smushable if not the just add and return
-        for (size_type i = 0; i < this->height; ++i)
-        {
-          if ((fig_str[i].back() == this->hard_blank) && !(fig_chr[i].front() == this->hard_blank))
-          {
-            return this->add_fig_str_and_fig_char(fig_str, fig_chr);
-          }
-          else if (fig_str[i].size() == 0 || fig_str[i].size() == 0)
-          {
-            return this->add_fig_str_and_fig_char(fig_str, fig_chr);
-          }
-        }
+        // clear the fig str, rows of the fig char and trailing spaces
+        this->clear_buffer(params, buffer);
 
-        // smush the fig str and fig char
-        for (size_type i = 0; i < fig_str.size(); ++i)
+        // verify the height
+        this->verify_height(params, buffer.fig_chs);
+
+        // smush the chars
+        for (const auto &fig_char : buffer.fig_chs)
         {
-          fig_str[i].back() = this->smush_rules(fig_str[i].back(), fig_chr[i].front());
-          fig_chr[i].erase(fig_chr[i].begin());
+          this->trim_fig_str_and_fig_char(buffer.fig_str, buffer.trails, fig_char, buffer.fig_rows);
+          this->smush_fig_str_and_fig_char(params, buffer.fig_str, buffer.trails, buffer.fig_rows);
+          this->add_fig_str_and_fig_char(buffer.fig_str, buffer.fig_rows);
+          this->update_trails(buffer.trails, fig_char, buffer.fig_rows);
         }
 
-        // Add the fig char to the fig str
-        this->add_fig_str_and_fig_char(fig_str, fig_chr);
+        // remove hardblank
+        this->rm_hardblank(params, buffer.fig_str);
       }
 
-    public:                                                            // public methods
       /**
-       * @brief Get the Fig string
+       * @brief Measure the width of the Fig string
+       *
+       * @details rows are tracked by width, trailing spaces and the last non
+       * space character (backs), that is all the smush rules look at
        */
-      fig_str_type get_fig_str(std::vector<fig_char_type> fig_chrs) const
+      size_type measure_fig_str(const fig_params_type &params, render_buffer_type &buffer) const override
       {
-        // fig str container type
-        fig_str_type fig_str(this->height);
+        // widths, trailing spaces and last non space of the rows
+        buffer.widths.assign(params.height, 0);
+        buffer.trails.assign(params.height, 0);
+        buffer.backs.assign(params.height, traits_type::to_char_type(' '));
+        buffer.fig_rows.resize(params.height);
 
         // verify the height
-        this->verify_height(fig_chrs);
+        this->verify_height(params, buffer.fig_chs);
 
         // smush the chars
-        for (auto &fig_char : fig_chrs)
+        for (const auto &fig_char : buffer.fig_chs)
         {
-          this->trim_fig_str_and_fig_char(fig_str, fig_char);
-          this->smush_fig_str_and_fig_char(fig_str, fig_char);
+          this->trim_widths_and_fig_char(buffer, fig_char);
+          this->smush_widths_and_fig_char(params, buffer);
+
+          for (size_type i = 0; i < params.height; ++i)
+          {
+            // size of the added row
+            const auto size = buffer.fig_rows[i].size();
+
+            buffer.widths[i] += size;
+
+            if (fig_char.trail(i) < size)
+            {
+              buffer.trails[i] = fig_char.trail(i);
+              buffer.backs[i] = buffer.fig_rows[i][size - fig_char.trail(i) - 1];
+            }
+            else
+            {
+              buffer.trails[i] += size;
+            }
+          }
         }
 
-        // remove hardblank
-        return this->rm_hardblank(fig_str);
+        // return
+        return this->max_width(buffer);
       }
 
       /**
@@ -7,6 +7,14 @@
 #ifndef SRILAKSHMIKANTHANP_LIBFIGLET_TYPES_HPP
 #define SRILAKSHMIKANTHANP_LIBFIGLET_TYPES_HPP
 
+#include <cstdint>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace srilakshmikanthanp
 {
   namespace libfiglet
@@ -20,6 +28,498 @@ namespace srilakshmikanthanp
       KERNING,        // Kerning
       SMUSHED         // Smushed
     };
+
+    /**
+     * @brief What the figlet does with a character the font has no fig char for
+     */
+    enum class missing_glyph_type : int
+    {
+      FAIL,           // Fail the render (throw or error code)
+      SKIP,           // Skip the character
+      SUBSTITUTE      // Use the fallback fig char (code 0 as FIGlet) or skip
+    };
+
+    /**
+     * @brief Instruction set of the row compositor
+     */
+    enum class simd_type : int
+    {
+      SCALAR,         // Plain loops
+      SSE2,           // 128 bit vectors
+      AVX2            // 256 bit vectors
+    };
+
+    /**
+     * @brief Horizontal layout of a font (bits of the Full_Layout header parameter)
+     */
+    using layout_type = std::uint32_t;
+
+    /**
+     * @brief Bits of the horizontal layout
+     */
+    struct fig_layout
+    {
+      static constexpr layout_type EQUAL       = 1;     // equal character smushing
+      static constexpr layout_type UNDERSCORE  = 2;     // underscore smushing
+      static constexpr layout_type HIERARCHY   = 4;     // hierarchy smushing
+      static constexpr layout_type OPPOSITE    = 8;     // opposite pair smushing
+      static constexpr layout_type BIG_X       = 16;    // big x smushing
+      static constexpr layout_type HARD_BLANK  = 32;    // hardblank smushing
+      static constexpr layout_type KERNING     = 64;    // horizontal fitting
+      static constexpr layout_type SMUSHING    = 128;   // horizontal smushing
+      static constexpr layout_type RULES       = 63;    // controlled smushing rules
+      static constexpr layout_type HORIZONTAL  = 255;   // horizontal layout bits
+    };
+
+    /**
+     * @brief Get the horizontal layout from the Old_Layout header parameter
+     */
+    constexpr layout_type make_layout(int old_layout)
+    {
+      if (old_layout < 0) // less than 0 then FULL_WIDTH
+      {
+        return 0;
+      }
+
+      if (old_layout == 0) // equal to 0 then KERNING
+      {
+        return fig_layout::KERNING;
+      }
+
+      // greater than 0 then SMUSHED with the rules
+      return fig_layout::SMUSHING | (static_cast<layout_type>(old_layout) & fig_layout::RULES);
+    }
+
+    /**
+     * @brief Get the shrink level of the horizontal layout
+     */
+    constexpr shrink_type layout_shrink_level(layout_type layout)
+    {
+      if (layout & fig_layout::SMUSHING)
+      {
+        return shrink_type::SMUSHED;
+      }
+
+      if (layout & fig_layout::KERNING)
+      {
+        return shrink_type::KERNING;
+      }
+
+      return shrink_type::FULL_WIDTH;
+    }
+
+    /**
+     * @brief Parameters of the font a figlet string is rendered with
+     */
+    template <class char_type_t>
+    struct basic_fig_params
+    {
+      char_type_t hard_blank;     // hard blank character of the font
+      std::size_t height;         // height of the font
+      layout_type layout;         // horizontal layout of the font
+    };
+
+    /**
+     * @brief Vector with the allocator of the string type rebound to the
+     * value, buffers of a figlet allocate from where its strings do (a
+     * std::pmr string type gives std::pmr vectors)
+     */
+    template <class string_type_t, class value_type_t>
+    using basic_alloc_vector = std::vector<value_type_t, typename std::allocator_traits<typename string_type_t::allocator_type>::template rebind_alloc<value_type_t>>;
+
+    /**
+     * @brief Size of a figlet string
+     */
+    struct fig_size_type
+    {
+      std::size_t width;      // width of the longest row
+      std::size_t height;     // number of rows
+    };
+
+    /**
+     * @brief Location of a fig char row in a glyph buffer
+     */
+    struct fig_row_type
+    {
+      std::uint32_t offset;   // offset of the row in the buffer
+      std::uint32_t width;    // width of the row
+      std::uint32_t lead;     // leading spaces of the row
+      std::uint32_t trail;    // trailing spaces of the row
+    };
+
+    /**
+     * @brief Make the location and the edge spaces of a fig char row
+     *
+     * @param offset offset of the row in the buffer
+     * @param row row of the fig char
+     */
+    template <class char_type_t, class traits_type_t>
+    constexpr fig_row_type make_fig_row(std::uint32_t offset, std::basic_string_view<char_type_t, traits_type_t> row)
+    {
+      // leading and trailing spaces
+      std::size_t lead = 0, trail = 0;
+
+      while (lead < row.size() && row[lead] == ' ')
+      {
+        ++lead;
+      }
+
+      while (trail < row.size() && row[row.size() - trail - 1] == ' ')
+      {
+        ++trail;
+      }
+
+      return {
+        offset,
+        static_cast<std::uint32_t>(row.size()),
+        static_cast<std::uint32_t>(lead),
+        static_cast<std::uint32_t>(trail)
+      };
+    }
+
+    /**
+     * @brief View of a fig char stored in a glyph buffer
+     */
+    template <class char_type_t, class traits_type_t = std::char_traits<char_type_t>>
+    class basic_fig_char_view
+    {
+    public:                                                                   // public type definition
+      using char_type        =   char_type_t;                                 // Character Type
+      using traits_type      =   traits_type_t;                               // Traits Type
+      using size_type        =   std::size_t;                                 // Size Type
+      using string_view_type =   std::basic_string_view<char_type, traits_type>;  // Row Type
+
+    private:                                                                  // Private members
+      const char_type *glyphs;                                                // glyph buffer
+      const fig_row_type *rows;                                               // rows of the fig char
+      size_type height;                                                       // height of the fig char
+
+    public:                                                                   // Public constructors
+      /**
+       * @brief Construct a empty view
+       */
+      constexpr basic_fig_char_view() : glyphs(nullptr), rows(nullptr), height(0) {}
+
+      /**
+       * @brief Construct a view of height rows from the glyph buffer
+       */
+      constexpr basic_fig_char_view(const char_type *glyphs, const fig_row_type *rows, size_type height)
+        : glyphs(glyphs), rows(rows), height(height) {}
+
+    public:                                                                   // Public methods
+      /**
+       * @brief Get the height of the fig char
+       */
+      constexpr size_type size() const
+      {
+        return this->height;
+      }
+
+      /**
+       * @brief Get the row of the fig char
+       */
+      constexpr string_view_type operator[](size_type row) const
+      {
+        return string_view_type(this->glyphs + this->rows[row].offset, this->rows[row].width);
+      }
+
+      /**
+       * @brief Get the row table of the fig char
+       */
+      constexpr const fig_row_type *data() const
+      {
+        return this->rows;
+      }
+
+      /**
+       * @brief Get the leading spaces of the row
+       */
+      constexpr size_type lead(size_type row) const
+      {
+        return this->rows[row].lead;
+      }
+
+      /**
+       * @brief Get the trailing spaces of the row
+       */
+      constexpr size_type trail(size_type row) const
+      {
+        return this->rows[row].trail;
+      }
+    };
+
+    /**
+     * @brief Rows of a figlet string in one preallocated grid of characters
+     *
+     * @details the grid is height rows of width + 1 cells in a single string,
+     * each row grows in its own cells so rows never reallocate while the
+     * fig chars are added. The width is an upper bound of the rows given
+     * before the render (kerning and smushing only remove characters). The
+     * rows are joined with new line in place and the grid string itself
+     * becomes the figlet string.
+     */
+    template <class string_type_t>
+    class basic_fig_grid
+    {
+    public:                                                                   // public type definition
+      using string_type      =   string_type_t;                               // String Type
+      using char_type        =   typename string_type_t::value_type;          // Character Type
+      using traits_type      =   typename string_type_t::traits_type;         // Traits Type
+      using size_type        =   typename string_type_t::size_type;           // Size Type
+      using allocator_type   =   typename string_type_t::allocator_type;      // Allocator Type
+      using string_view_type =   std::basic_string_view<char_type, traits_type>;  // Row Type
+      using rows_type        =   basic_alloc_vector<string_type_t, string_type_t>;  // Rows Type
+
+      /**
+       * @brief Row of the grid, a string of fixed capacity in the grid
+       */
+      class row_type
+      {
+      private:                                                                // Private members
+        char_type *cells;                                                     // cells of the row
+        size_type *length;                                                    // length of the row
+
+      public:                                                                 // Public constructors
+        row_type(char_type *cells, size_type *length) : cells(cells), length(length) {}
+
+      public:                                                                 // Public methods
+        size_type size() const { return *this->length; }                     // length of the row
+        bool empty() const { return *this->length == 0; }                     // row is empty
+        char_type *data() const { return this->cells; }                       // first character
+        char_type *begin() const { return this->cells; }                      // first character
+        char_type *end() const { return this->cells + *this->length; }        // past the last character
+        char_type &back() const { return this->cells[*this->length - 1]; }    // last character
+
+        /**
+         * @brief Resize the row, new characters are ch
+         */
+        void resize(size_type size, char_type ch = char_type())
+        {
+          if (size > *this->length)
+          {
+            traits_type::assign(this->cells + *this->length, size - *this->length, ch);
+          }
+
+          *this->length = size;
+        }
+
+        /**
+         * @brief Set the row to the text
+         */
+        void assign(string_view_type text)
+        {
+          traits_type::copy(this->cells, text.data(), text.size());
+          *this->length = text.size();
+        }
+
+        /**
+         * @brief Set the row to count ch
+         */
+        void assign(size_type count, char_type ch)
+        {
+          traits_type::assign(this->cells, count, ch);
+          *this->length = count;
+        }
+
+        /**
+         * @brief Add the text to the row
+         */
+        row_type &operator+=(string_view_type text)
+        {
+          traits_type::copy(this->cells + *this->length, text.data(), text.size());
+          *this->length += text.size();
+          return *this;
+        }
+
+        /**
+         * @brief Get the row as view
+         */
+        operator string_view_type() const
+        {
+          return string_view_type(this->cells, *this->length);
+        }
+      };
+
+      /**
+       * @brief Iterator over the rows as views
+       */
+      class const_iterator
+      {
+      public:                                                                 // iterator traits
+        using iterator_category = std::forward_iterator_tag;                  // Category
+        using value_type        = string_view_type;                           // Row
+        using difference_type   = std::ptrdiff_t;                             // Distance
+        using pointer           = const string_view_type *;                   // Pointer
+        using reference         = string_view_type;                           // Reference
+
+      private:                                                                // Private members
+        const basic_fig_grid *grid;                                           // grid of the rows
+        size_type row;                                                        // index of the row
+
+      public:                                                                 // Public constructors
+        const_iterator(const basic_fig_grid *grid, size_type row) : grid(grid), row(row) {}
+
+      public:                                                                 // Public methods
+        string_view_type operator*() const { return (*this->grid)[this->row]; }
+        const_iterator &operator++() { ++this->row; return *this; }
+        const_iterator operator++(int) { auto itr = *this; ++this->row; return itr; }
+        bool operator==(const const_iterator &other) const { return this->row == other.row; }
+        bool operator!=(const const_iterator &other) const { return this->row != other.row; }
+      };
+
+    private:                                                                  // Private members
+      string_type cells;                                                      // rows of width + 1 cells
+      basic_alloc_vector<string_type_t, size_type> lengths;                   // length of each row
+      size_type stride = 0;                                                   // cells of a row
+
+    public:                                                                   // Public constructors
+      basic_fig_grid() = default;                                             // default constructor
+
+      /**
+       * @brief Construct an empty grid allocating from the allocator
+       */
+      explicit basic_fig_grid(const allocator_type &alloc) : cells(alloc), lengths(alloc) {}
+
+    public:                                                                   // Public methods
+      /**
+       * @brief Get the allocator of the grid
+       */
+      allocator_type get_allocator() const
+      {
+        return this->cells.get_allocator();
+      }
+
+      /**
+       * @brief Make height empty rows of width characters at most, the
+       * cells of the previous render are reused
+       */
+      void reset(size_type height, size_type width)
+      {
+        this->stride = width + 1;
+        this->lengths.assign(height, 0);
+
+        if (this->cells.size() < height * this->stride)
+        {
+          this->cells.resize(height * this->stride);
+        }
+      }
+
+      /**
+       * @brief Remove all the rows
+       */
+      void clear()
+      {
+        this->lengths.clear();
+      }
+
+      /**
+       * @brief Get the number of rows
+       */
+      size_type size() const
+      {
+        return this->lengths.size();
+      }
+
+      /**
+       * @brief Check the grid has no rows
+       */
+      bool empty() const
+      {
+        return this->lengths.empty();
+      }
+
+      /**
+       * @brief Get the number of cells the grid holds without allocation
+       */
+      size_type capacity() const
+      {
+        return this->cells.capacity();
+      }
+
+      /**
+       * @brief Get the row to build
+       */
+      row_type operator[](size_type row)
+      {
+        return row_type(&this->cells[row * this->stride], &this->lengths[row]);
+      }
+
+      /**
+       * @brief Get the row
+       */
+      string_view_type operator[](size_type row) const
+      {
+        return string_view_type(this->cells.data() + row * this->stride, this->lengths[row]);
+      }
+
+      const_iterator begin() const { return const_iterator(this, 0); }                  // first row
+      const_iterator end() const { return const_iterator(this, this->size()); }         // past the last row
+
+      /**
+       * @brief Get the size of the rows joined with new line
+       */
+      size_type joined_size() const
+      {
+        size_type size = 0;
+
+        for (const auto length : this->lengths)
+        {
+          size += length + 1;
+        }
+
+        return size;
+      }
+
+      /**
+       * @brief Join the rows with new line in place, the rows are removed
+       *
+       * @return figlet string in the cells of the grid (valid till the next render)
+       */
+      string_view_type join()
+      {
+        // end of the joined rows
+        size_type size = 0;
+
+        for (size_type i = 0; i < this->lengths.size(); ++i)
+        {
+          traits_type::move(&this->cells[size], &this->cells[i * this->stride], this->lengths[i]);
+          size += this->lengths[i];
+          this->cells[size++] = traits_type::to_char_type('\n');
+        }
+
+        // no rows
+        this->lengths.clear();
+
+        // return
+        return string_view_type(this->cells.data(), size);
+      }
+
+      /**
+       * @brief Join the rows with new line in place and swap the grid into
+       * the value, the grid takes the old storage of the value (copied
+       * instead when the value allocates from elsewhere)
+       */
+      void join(string_type &value)
+      {
+        // storage of other allocator is not swapped
+        if (!(this->cells.get_allocator() == value.get_allocator()))
+        {
+          value.assign(this->join());
+          return;
+        }
+
+        this->cells.resize(this->join().size());
+        this->cells.swap(value);
+      }
+
+      /**
+       * @brief Copy the rows to strings of the allocator of the grid
+       */
+      rows_type to_rows() const
+      {
+        return rows_type(this->begin(), this->end(), this->get_allocator());
+      }
+    };
   }
 }
 
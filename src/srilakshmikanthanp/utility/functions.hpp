@@ -6,6 +6,9 @@
 #ifndef SRILAKSHMIKANTHANP_UTILITIES_FUNCTIONS_HPP
 #define SRILAKSHMIKANTHANP_UTILITIES_FUNCTIONS_HPP
 
+#include <string>
+#include <type_traits>
+
 namespace srilakshmikanthanp
 {
   namespace libfiglet
@@ -21,6 +24,78 @@ namespace srilakshmikanthanp
     {
       return string_type_t(str.begin(), str.end());
     }
+
+    /**
+     * @brief Get the code point of the character (unsigned value of the unit)
+     *
+     * @param ch character to convert
+     * @return char32_t code point
+     */
+    template <class char_type_t>
+    constexpr char32_t to_code(char_type_t ch)
+    {
+      return static_cast<char32_t>(static_cast<std::make_unsigned_t<char_type_t>>(ch));
+    }
+
+    /**
+     * @brief Decode the next code point of the text and advance the iterator
+     *
+     * @details char text is UTF-8, a byte that does not start a valid
+     * sequence is taken as Latin-1 so text in either encoding works. Wider
+     * characters are code points as they are.
+     *
+     * @param itr iterator to the next character, advanced past the code point
+     * @param end end of the text
+     * @return char32_t code point
+     */
+    template <class iterator_type_t>
+    constexpr char32_t next_code(iterator_type_t &itr, iterator_type_t end)
+    {
+      // lead unit
+      const auto lead = to_code(*itr++);
+
+      // not UTF-8 or ascii
+      if constexpr (sizeof(*itr) != 1)
+      {
+        return lead;
+      }
+      else
+      {
+        // length of the sequence
+        const int length = lead < 0x80 ? 1 : (lead >> 5) == 0x06 ? 2 : (lead >> 4) == 0x0E ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+
+        if (length <= 1)
+        {
+          return lead;
+        }
+
+        // continuation units
+        auto next = itr;
+        auto code = lead & (0xFF >> (length + 1));
+
+        for (int i = 1; i < length; ++i, ++next)
+        {
+          if (next == end || (to_code(*next) & 0xC0) != 0x80)
+          {
+            return lead;
+          }
+
+          code = (code << 6) | (to_code(*next) & 0x3F);
+        }
+
+        // overlong, surrogate or out of range is not UTF-8
+        const char32_t min[] = {0, 0, 0x80, 0x800, 0x10000};
+
+        if (code < min[length] || (code >= 0xD800 && code <= 0xDFFF) || code > 0x10FFFF)
+        {
+          return lead;
+        }
+
+        itr = next;
+
+        return code;
+      }
+    }
   }
 }
 
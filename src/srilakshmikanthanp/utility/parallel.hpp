@@ -0,0 +1,116 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SRILAKSHMIKANTHANP_UTILITIES_PARALLEL_HPP
+#define SRILAKSHMIKANTHANP_UTILITIES_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    /**
+     * @brief Get the number of threads to use (0 is the hardware concurrency)
+     *
+     * @param threads requested threads
+     * @param count number of tasks
+     */
+    inline std::size_t thread_count(std::size_t threads, std::size_t count)
+    {
+      if (threads == 0)
+      {
+        threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+      }
+
+      return std::max<std::size_t>(std::min(threads, count), 1);
+    }
+
+    /**
+     * @brief Call function(i) for i in [0, count) on the threads
+     *
+     * @details indexes are claimed one by one from a shared counter so a slow
+     * task does not hold back the others, the first exception is rethrown
+     * after all the threads are joined. When a thread cannot be started the
+     * tasks are run on the threads already started and the calling thread.
+     *
+     * @param count number of tasks
+     * @param threads number of threads (0 is the hardware concurrency)
+     * @param function task to run
+     */
+    template <class function_type>
+    void parallel_for(std::size_t count, std::size_t threads, function_type function)
+    {
+      // next index to claim
+      std::atomic<std::size_t> next(0);
+
+      // first error
+      std::exception_ptr error;
+      std::mutex error_mutex;
+
+      // worker function
+      auto worker = [&]() {
+        for (auto i = next++; i < count; i = next++)
+        {
+          try
+          {
+            function(i);
+          }
+          catch(...)
+          {
+            std::lock_guard<std::mutex> lock(error_mutex);
+
+            if (!error)
+            {
+              error = std::current_exception();
+            }
+
+            next = count;
+          }
+        }
+      };
+
+      // worker threads (reserved so a started thread is never lost to a reallocation)
+      std::vector<std::thread> pool;
+      pool.reserve(thread_count(threads, count) - 1);
+
+      for (std::size_t t = 1; t < thread_count(threads, count); ++t)
+      {
+        try
+        {
+          pool.emplace_back(worker);
+        }
+        catch (const std::system_error &)
+        {
+          // no more threads, the started ones and this thread do the work
+          break;
+        }
+      }
+
+      // this thread works too
+      worker();
+
+      for (auto &thread : pool)
+      {
+        thread.join();
+      }
+
+      // rethrow the error
+      if (error)
+      {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,332 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#ifndef SRILAKSHMIKANTHANP_UTILITIES_SIMD_HPP
+#define SRILAKSHMIKANTHANP_UTILITIES_SIMD_HPP
+
+#include "../types/types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SRILAKSHMIKANTHANP_LIBFIGLET_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(SRILAKSHMIKANTHANP_LIBFIGLET_SSE2) && (defined(__GNUC__) || defined(__clang__))
+#define SRILAKSHMIKANTHANP_LIBFIGLET_AVX2
+#include <immintrin.h>
+#endif
+
+namespace srilakshmikanthanp
+{
+  namespace libfiglet
+  {
+    namespace simd
+    {
+      /**
+       * @brief Copy n units replacing from with to, one unit at a time
+       */
+      template <class unit_type_t>
+      inline void copy_replace_scalar(unit_type_t *dst, const unit_type_t *src, std::size_t n, unit_type_t from, unit_type_t to)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          dst[i] = src[i] == from ? to : src[i];
+        }
+      }
+
+#ifdef SRILAKSHMIKANTHANP_LIBFIGLET_SSE2
+      /**
+       * @brief Fill a 128 bit vector with the unit
+       */
+      template <class unit_type_t>
+      inline __m128i set1_128(unit_type_t unit)
+      {
+        if constexpr (sizeof(unit_type_t) == 1)
+        {
+          return _mm_set1_epi8(static_cast<char>(unit));
+        }
+        else if constexpr (sizeof(unit_type_t) == 2)
+        {
+          return _mm_set1_epi16(static_cast<short>(unit));
+        }
+        else
+        {
+          return _mm_set1_epi32(static_cast<int>(unit));
+        }
+      }
+
+      /**
+       * @brief Compare the units of two 128 bit vectors
+       */
+      template <class unit_type_t>
+      inline __m128i cmpeq_128(__m128i lhs, __m128i rhs)
+      {
+        if constexpr (sizeof(unit_type_t) == 1)
+        {
+          return _mm_cmpeq_epi8(lhs, rhs);
+        }
+        else if constexpr (sizeof(unit_type_t) == 2)
+        {
+          return _mm_cmpeq_epi16(lhs, rhs);
+        }
+        else
+        {
+          return _mm_cmpeq_epi32(lhs, rhs);
+        }
+      }
+
+      /**
+       * @brief Copy and replace one 128 bit vector
+       */
+      template <class unit_type_t>
+      inline void copy_replace_128(unit_type_t *dst, const unit_type_t *src, __m128i from, __m128i to)
+      {
+        const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+        const auto mask = cmpeq_128<unit_type_t>(value, from);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_or_si128(_mm_andnot_si128(mask, value), _mm_and_si128(mask, to)));
+      }
+
+      /**
+       * @brief Copy n units replacing from with to with 128 bit vectors
+       *
+       * @details the last vector overlaps the previous one instead of a scalar
+       * tail, rows shorter than a vector are done with two overlapping 64 or
+       * 32 bit parts as fig char rows are often a few characters.
+       */
+      template <class unit_type_t>
+      inline void copy_replace_sse2(unit_type_t *dst, const unit_type_t *src, std::size_t n, unit_type_t from, unit_type_t to)
+      {
+        // units of a vector
+        constexpr std::size_t width = 16 / sizeof(unit_type_t);
+
+        // shorter than a quarter vector
+        if (n * sizeof(unit_type_t) < 4)
+        {
+          return copy_replace_scalar(dst, src, n, from, to);
+        }
+
+        const auto vfrom = set1_128(from);
+        const auto vto = set1_128(to);
+
+        // two overlapping quarters
+        if (n < width / 2)
+        {
+          const auto copy = [&](std::size_t at) {
+            std::int32_t bits;
+            std::memcpy(&bits, src + at, sizeof(bits));
+
+            const auto value = _mm_cvtsi32_si128(bits);
+            const auto mask = cmpeq_128<unit_type_t>(value, vfrom);
+
+            bits = _mm_cvtsi128_si32(_mm_or_si128(_mm_andnot_si128(mask, value), _mm_and_si128(mask, vto)));
+            std::memcpy(dst + at, &bits, sizeof(bits));
+          };
+
+          copy(0);
+          copy(n - 4 / sizeof(unit_type_t));
+          return;
+        }
+
+        // two overlapping halves
+        if (n < width)
+        {
+          const auto copy = [&](std::size_t at) {
+            const auto value = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + at));
+            const auto mask = cmpeq_128<unit_type_t>(value, vfrom);
+
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + at), _mm_or_si128(_mm_andnot_si128(mask, value), _mm_and_si128(mask, vto)));
+          };
+
+          copy(0);
+          copy(n - width / 2);
+          return;
+        }
+
+        // full vectors
+        for (std::size_t i = 0; i + width <= n; i += width)
+        {
+          copy_replace_128(dst + i, src + i, vfrom, vto);
+        }
+
+        // last vector
+        if (n % width != 0)
+        {
+          copy_replace_128(dst + n - width, src + n - width, vfrom, vto);
+        }
+      }
+#endif
+
+#ifdef SRILAKSHMIKANTHANP_LIBFIGLET_AVX2
+      /**
+       * @brief Fill a 256 bit vector with the unit
+       */
+      template <class unit_type_t>
+      __attribute__((target("avx2"))) inline __m256i set1_256(unit_type_t unit)
+      {
+        if constexpr (sizeof(unit_type_t) == 1)
+        {
+          return _mm256_set1_epi8(static_cast<char>(unit));
+        }
+        else if constexpr (sizeof(unit_type_t) == 2)
+        {
+          return _mm256_set1_epi16(static_cast<short>(unit));
+        }
+        else
+        {
+          return _mm256_set1_epi32(static_cast<int>(unit));
+        }
+      }
+
+      /**
+       * @brief Copy and replace one 256 bit vector
+       */
+      template <class unit_type_t>
+      __attribute__((target("avx2"))) inline void copy_replace_256(unit_type_t *dst, const unit_type_t *src, __m256i from, __m256i to)
+      {
+        const auto value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src));
+        __m256i mask;
+
+        if constexpr (sizeof(unit_type_t) == 1)
+        {
+          mask = _mm256_cmpeq_epi8(value, from);
+        }
+        else if constexpr (sizeof(unit_type_t) == 2)
+        {
+          mask = _mm256_cmpeq_epi16(value, from);
+        }
+        else
+        {
+          mask = _mm256_cmpeq_epi32(value, from);
+        }
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), _mm256_blendv_epi8(value, to, mask));
+      }
+
+      /**
+       * @brief Copy n units replacing from with to with 256 bit vectors, rows
+       * shorter than a vector are done with 128 bit vectors
+       */
+      template <class unit_type_t>
+      __attribute__((target("avx2"))) inline void copy_replace_avx2(unit_type_t *dst, const unit_type_t *src, std::size_t n, unit_type_t from, unit_type_t to)
+      {
+        // units of a vector
+        constexpr std::size_t width = 32 / sizeof(unit_type_t);
+
+        // shorter than a vector
+        if (n < width)
+        {
+          return copy_replace_sse2(dst, src, n, from, to);
+        }
+
+        const auto vfrom = set1_256(from);
+        const auto vto = set1_256(to);
+
+        // full vectors
+        for (std::size_t i = 0; i + width <= n; i += width)
+        {
+          copy_replace_256(dst + i, src + i, vfrom, vto);
+        }
+
+        // last vector
+        if (n % width != 0)
+        {
+          copy_replace_256(dst + n - width, src + n - width, vfrom, vto);
+        }
+      }
+#endif
+
+      /**
+       * @brief Get the best instruction set of the processor
+       */
+      inline simd_type detect()
+      {
+#if defined(SRILAKSHMIKANTHANP_LIBFIGLET_AVX2)
+        return __builtin_cpu_supports("avx2") ? simd_type::AVX2 : simd_type::SSE2;
+#elif defined(SRILAKSHMIKANTHANP_LIBFIGLET_SSE2)
+        return simd_type::SSE2;
+#else
+        return simd_type::SCALAR;
+#endif
+      }
+
+      /**
+       * @brief Instruction set in use, detected once
+       */
+      inline std::atomic<simd_type> current(detect());
+    }
+
+    /**
+     * @brief Get the best instruction set of the processor
+     */
+    inline simd_type get_supported_simd()
+    {
+      static const auto supported = simd::detect();
+      return supported;
+    }
+
+    /**
+     * @brief Get the instruction set of the row compositor
+     */
+    inline simd_type get_simd()
+    {
+      return simd::current.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Set the instruction set of the row compositor, limited to the
+     * instruction sets of the processor (output is the same with all)
+     *
+     * @return instruction set in use
+     */
+    inline simd_type set_simd(simd_type type)
+    {
+      const auto used = static_cast<int>(type) < static_cast<int>(get_supported_simd()) ? type : get_supported_simd();
+      simd::current.store(used, std::memory_order_relaxed);
+      return used;
+    }
+
+    /**
+     * @brief Copy the row to dst replacing the hard blank with space in one pass
+     *
+     * @param dst destination of size n at least
+     * @param src source row of size n
+     * @param n number of characters
+     * @param from character to replace
+     * @param to character to replace with
+     */
+    template <class char_type_t>
+    inline void copy_replace(char_type_t *dst, const char_type_t *src, std::size_t n, char_type_t from, char_type_t to)
+    {
+      // vector of the unit size
+      if constexpr (sizeof(char_type_t) == 1 || sizeof(char_type_t) == 2 || sizeof(char_type_t) == 4)
+      {
+        switch (get_simd())
+        {
+#ifdef SRILAKSHMIKANTHANP_LIBFIGLET_AVX2
+          case simd_type::AVX2:
+            return simd::copy_replace_avx2(dst, src, n, from, to);
+#endif
+#ifdef SRILAKSHMIKANTHANP_LIBFIGLET_SSE2
+          case simd_type::SSE2:
+            return simd::copy_replace_sse2(dst, src, n, from, to);
+#endif
+          default:
+            break;
+        }
+      }
+
+      // scalar
+      simd::copy_replace_scalar(dst, src, n, from, to);
+    }
+  }
+}
+
+#endif // SRILAKSHMIKANTHANP_UTILITIES_SIMD_HPP
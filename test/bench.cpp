@@ -0,0 +1,802 @@
+// Copyright (c) 2022 Sri Lakshmi Kanthan P
+//
+// This software is released under the MIT License.
+// https://opensource.org/licenses/MIT
+
+#include "../src/srilakshmikanthanp/libfiglet.hpp"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+#include <sstream>
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+using namespace srilakshmikanthanp::libfiglet;
+
+/**
+ * @brief Time the function in milliseconds (best of the runs)
+ */
+template <class function_type>
+double time_ms(function_type function, int runs = 5)
+{
+  // best time
+  double best = 0;
+
+  for (int i = 0; i < runs; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const auto took = std::chrono::duration<double, std::milli>(end - start).count();
+
+    if (i == 0 || took < best)
+    {
+      best = took;
+    }
+  }
+
+  return best;
+}
+
+/**
+ * @brief List the fonts in the directory
+ */
+std::vector<std::string> list_fonts(const std::string &base_dir_path)
+{
+  std::vector<std::string> fonts;
+
+  for (const auto & entry : std::filesystem::directory_iterator(base_dir_path))
+  {
+    fonts.push_back(entry.path().string());
+  }
+
+  return fonts;
+}
+
+/**
+ * @brief Load every font in the directory (fonts that fail are counted)
+ */
+template <class font_type>
+void load_fonts(const std::vector<std::string> &fonts)
+{
+  for (const auto &font : fonts)
+  {
+    try
+    {
+      font_type::make_shared(font);
+    }
+    catch(const std::exception&)
+    {
+      // Some fonts are not supported
+    }
+  }
+}
+
+void flf_font_bench(void)
+{
+  // fonts to load
+  const auto fonts = list_fonts("./assets/fonts");
+
+  // using std::string
+  const auto took = time_ms([&]{ load_fonts<flf_font>(fonts); });
+
+  // using std::wstring
+  const auto wtook = time_ms([&]{ load_fonts<wflf_font>(fonts); });
+
+  std::cout << "load " << fonts.size() << " fonts (flf_font)  : " << took  << " ms" << std::endl;
+  std::cout << "load " << fonts.size() << " fonts (wflf_font) : " << wtook << " ms" << std::endl;
+
+  // load in parallel
+  for (std::size_t threads = 1; threads <= std::thread::hardware_concurrency(); threads *= 2)
+  {
+    const auto ptook = time_ms([&]{ load_flf_fonts<std::string>(fonts, threads); });
+    std::cout << "load " << fonts.size() << " fonts (load_flf_fonts, " << threads << " threads) : " << ptook << " ms" << std::endl;
+  }
+}
+
+void compiled_font_bench(void)
+{
+  // compile the fonts
+  const auto out_dir_path  = (std::filesystem::temp_directory_path() / "libfiglet_bench").string();
+  const auto wout_dir_path = (std::filesystem::temp_directory_path() / "libfiglet_wbench").string();
+
+  compile_flf_fonts<std::string>("./assets/fonts", out_dir_path);
+  compile_flf_fonts<std::wstring>("./assets/fonts", wout_dir_path);
+
+  // fonts to load
+  const auto fonts  = list_fonts(out_dir_path);
+  const auto wfonts = list_fonts(wout_dir_path);
+
+  // using std::string
+  const auto took = time_ms([&]{ load_fonts<compiled_font>(fonts); });
+
+  // using std::wstring
+  const auto wtook = time_ms([&]{ load_fonts<wcompiled_font>(wfonts); });
+
+  std::cout << "load " << fonts.size()  << " fonts (compiled_font)  : " << took  << " ms" << std::endl;
+  std::cout << "load " << wfonts.size() << " fonts (wcompiled_font) : " << wtook << " ms" << std::endl;
+}
+
+/**
+ * @brief Render the text count times
+ */
+template <class figlet_type, class string_type>
+void render(const figlet_type &figlet, const string_type &text, int count)
+{
+  for (int i = 0; i < count; ++i)
+  {
+    figlet(text);
+  }
+}
+
+void figlet_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto font_path  = "./assets/fonts/Standard.flf";
+  const auto flf_font   = flf_font::make_shared(font_path);
+  const auto full_width = figlet(flf_font, full_width::make_shared());
+  const auto kerning    = figlet(flf_font, kerning::make_shared());
+  const auto smushed    = figlet(flf_font, smushed::make_shared());
+
+  // renders per run
+  const auto count = 10000;
+  const std::string text = "Hello, C++";
+
+  std::cout << "render x" << count << " (full_width) : " << time_ms([&]{ render(full_width, text, count); }) << " ms" << std::endl;
+  std::cout << "render x" << count << " (kerning)    : " << time_ms([&]{ render(kerning, text, count); })    << " ms" << std::endl;
+  std::cout << "render x" << count << " (smushed)    : " << time_ms([&]{ render(smushed, text, count); })    << " ms" << std::endl;
+
+  // render into a reused string
+  std::string value;
+
+  const auto took = time_ms([&]{
+    for (int i = 0; i < count; ++i)
+    {
+      smushed.render_into(text, value);
+    }
+  });
+
+  std::cout << "render x" << count << " (smushed, render_into) : " << took << " ms" << std::endl;
+
+  // measure without building the rows
+  const auto mtook = time_ms([&]{
+    for (int i = 0; i < count; ++i)
+    {
+      smushed.measure(text);
+    }
+  });
+
+  std::cout << "measure x" << count << " (smushed) : " << mtook << " ms" << std::endl;
+
+  // stream a long document word wrapped at 80 columns
+  std::string document;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    document += "The quick brown fox jumps over the lazy dog\n";
+  }
+
+  const auto stook = time_ms([&]{
+    std::istringstream in(document);
+    std::ostringstream out;
+    render_stream(smushed, in, out, 80);
+  });
+
+  std::cout << "render_stream " << document.size() << " chars (smushed, 80 columns) : " << stook << " ms" << std::endl;
+}
+
+void accelerated_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto font_path   = "./assets/fonts/Standard.flf";
+  const auto flf_font    = flf_font::make_shared(font_path);
+  const auto kerning     = figlet(flf_font, kerning::make_shared());
+  const auto smushed     = figlet(flf_font, smushed::make_shared());
+
+  // precompute the pairs
+  std::shared_ptr<accelerated_smushed> style;
+  const auto build = time_ms([&]{ style = accelerated_smushed::make_shared(flf_font); });
+
+  const auto accelerated_kerning = figlet(flf_font, accelerated_kerning::make_shared(flf_font));
+  const auto accelerated_smushed = figlet(flf_font, style);
+
+  // renders per run
+  const auto count = 10000;
+  const std::string text = "The quick brown fox jumps over the lazy dog";
+
+  std::cout << "build pairs (accelerated_smushed) : " << build << " ms" << std::endl;
+  std::cout << "render x" << count << " (kerning)             : " << time_ms([&]{ render(kerning, text, count); })             << " ms" << std::endl;
+  std::cout << "render x" << count << " (accelerated_kerning) : " << time_ms([&]{ render(accelerated_kerning, text, count); }) << " ms" << std::endl;
+  std::cout << "render x" << count << " (smushed)             : " << time_ms([&]{ render(smushed, text, count); })             << " ms" << std::endl;
+  std::cout << "render x" << count << " (accelerated_smushed) : " << time_ms([&]{ render(accelerated_smushed, text, count); }) << " ms" << std::endl;
+}
+
+void render_document_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // document of many lines
+  std::string doc;
+
+  for (int i = 0; i < 10000; ++i)
+  {
+    doc += "The quick brown fox jumps over the lazy dog\n";
+  }
+
+  // output reused across the runs
+  std::string value;
+
+  // scale from one thread to the hardware concurrency
+  const auto max_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+  {
+    const auto took = time_ms([&]{ smushed.render_document(doc, value, threads); });
+    std::cout << "render_document 10000 lines (" << threads << " threads) : " << took << " ms, " << 10000 / took << " lines/ms" << std::endl;
+  }
+}
+
+void render_cache_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // few hundred host names
+  std::vector<std::string> hosts;
+
+  for (int i = 0; i < 300; ++i)
+  {
+    hosts.push_back("host-" + std::to_string(i));
+  }
+
+  // cache of all the hosts
+  render_cache cache(1024);
+
+  // renders per run
+  const auto count = 100000;
+
+  const auto took  = time_ms([&]{ for (int i = 0; i < count; ++i) smushed(hosts[i % hosts.size()]); });
+  const auto ctook = time_ms([&]{ for (int i = 0; i < count; ++i) cache.render(smushed, hosts[i % hosts.size()]); });
+
+  std::cout << "render x" << count << " (smushed)              : " << took  << " ms" << std::endl;
+  std::cout << "render x" << count << " (smushed, render_cache) : " << ctook << " ms, hit rate " << cache.get_stats().hit_rate() << std::endl;
+}
+
+void render_batch_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // labels of the batch
+  std::vector<std::string> labels;
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    labels.push_back("host-" + std::to_string(i));
+  }
+
+  const std::vector<std::string_view> texts(labels.begin(), labels.end());
+
+  // one by one and as batch
+  render_batch batch;
+
+  std::vector<std::string> results(labels.size());
+
+  const auto took = time_ms([&]{ for (std::size_t i = 0; i < labels.size(); ++i) results[i] = smushed(labels[i]); });
+
+  std::cout << "render " << labels.size() << " labels (operator()) : " << took << " ms" << std::endl;
+
+  const auto max_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+  {
+    const auto btook = time_ms([&]{ smushed.render_batch(texts, batch, threads); });
+    std::cout << "render " << labels.size() << " labels (render_batch, " << threads << " threads) : " << btook << " ms" << std::endl;
+  }
+}
+
+void missing_glyph_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  auto smushed = figlet(flf_font, smushed::make_shared());
+
+  // text with a stray tab
+  const auto count = 10000;
+  const std::string text = "Hello,\tC++";
+
+  // exception for each render
+  const auto took = time_ms([&]{
+    for (int i = 0; i < count; ++i)
+    {
+      try
+      {
+        smushed(text);
+      }
+      catch (const std::exception &)
+      {
+        // missing glyph
+      }
+    }
+  });
+
+  // error code for each render
+  std::string value;
+  std::error_code ec;
+
+  const auto etook = time_ms([&]{ for (int i = 0; i < count; ++i) smushed.render_into(text, value, ec); });
+
+  // skip the tab
+  smushed.set_missing_glyph(missing_glyph_type::SKIP);
+
+  const auto stook = time_ms([&]{ for (int i = 0; i < count; ++i) smushed.render_into(text, value); });
+
+  std::cout << "render x" << count << " with missing glyph (exception)  : " << took  << " ms" << std::endl;
+  std::cout << "render x" << count << " with missing glyph (error code) : " << etook << " ms" << std::endl;
+  std::cout << "render x" << count << " with missing glyph (skip)       : " << stook << " ms" << std::endl;
+}
+
+void simd_bench(void)
+{
+  // renders per run
+  const auto count = 10000;
+  const std::string text = "Hello, C++";
+
+  // narrow and wide fig chars
+  for (const auto font_path : {"./assets/fonts/Standard.flf", "./assets/fonts/Doh.flf"})
+  {
+    const auto flf_font   = flf_font::make_shared(font_path);
+    const auto full_width = figlet(flf_font, full_width::make_shared());
+    const auto kerning    = figlet(flf_font, kerning::make_shared());
+
+    std::cout << font_path << std::endl;
+
+    for (const auto type : {simd_type::SCALAR, simd_type::SSE2, simd_type::AVX2})
+    {
+      // not supported
+      if (set_simd(type) != type)
+      {
+        continue;
+      }
+
+      std::cout << "render x" << count << " (full_width, simd " << static_cast<int>(type) << ") : " << time_ms([&]{ render(full_width, text, count); }) << " ms" << std::endl;
+      std::cout << "render x" << count << " (kerning, simd " << static_cast<int>(type) << ")    : " << time_ms([&]{ render(kerning, text, count); })    << " ms" << std::endl;
+    }
+  }
+
+  // best of the processor
+  set_simd(get_supported_simd());
+}
+
+void instrument_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+  const auto counted  = instrumented_figlet(flf_font, smushed::make_shared());
+
+  // renders per run
+  const auto count = 10000;
+  const std::string text = "Hello, C++";
+
+  std::cout << "render x" << count << " (smushed)                     : " << time_ms([&]{ render(smushed, text, count); }) << " ms" << std::endl;
+  std::cout << "render x" << count << " (smushed, stats_instrument)   : " << time_ms([&]{ render(counted, text, count); }) << " ms" << std::endl;
+
+  // phases of the renders
+  const auto stats = counted.get_instrument().get_stats();
+
+  std::cout << "lookup " << stats.lookup_ns / stats.renders << " ns, smushing " << stats.smushing_ns / stats.renders << " ns, assembly " << stats.assembly_ns / stats.renders << " ns per render" << std::endl;
+}
+
+/**
+ * @brief Result of a benchmark of the suite
+ */
+struct bench_result
+{
+  std::string group;          // what is measured (load, render, threads)
+  std::string name;           // font, style and input of the benchmark
+  std::string string_type;    // string, wstring or pmr::string
+  std::size_t threads;        // threads of the benchmark
+  std::size_t items;          // items (fonts, renders, texts) per run
+  int runs;                   // runs of the benchmark
+  double best_ms;             // fastest run
+  double mean_ms;             // mean of the runs
+};
+
+// results of the suite
+std::vector<bench_result> results;
+
+/**
+ * @brief Time the function for the runs and record the result
+ */
+template <class function_type>
+void record(const std::string &group, const std::string &name, const std::string &string_type, std::size_t threads, std::size_t items, function_type function, int runs = 5)
+{
+  // best and total time
+  double best = 0, total = 0;
+
+  for (int i = 0; i < runs; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    const auto end = std::chrono::steady_clock::now();
+    const auto took = std::chrono::duration<double, std::milli>(end - start).count();
+
+    best = i == 0 ? took : std::min(best, took);
+    total += took;
+  }
+
+  results.push_back({group, name, string_type, threads, items, runs, best, total / runs});
+
+  std::cout << group << " " << name << " (" << string_type << ", " << threads << " threads) : " << best << " ms, " << items / best * 1000 << " items/s" << std::endl;
+}
+
+/**
+ * @brief Escape the text as JSON string
+ */
+std::string json_string(const std::string &text)
+{
+  std::string value = "\"";
+
+  for (const auto ch : text)
+  {
+    switch (ch)
+    {
+      case '"':
+        value += "\\\"";
+        break;
+      case '\\':
+        value += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(ch) < 0x20)
+        {
+          char code[8];
+          std::snprintf(code, sizeof(code), "\\u%04x", ch);
+          value += code;
+        }
+        else
+        {
+          value += ch;
+        }
+    }
+  }
+
+  return value + "\"";
+}
+
+/**
+ * @brief Write the results of the suite as JSON
+ */
+void write_json(std::ostream &out)
+{
+  // context of the run
+  out << "{\n";
+  out << "  \"context\": {\n";
+  out << "    \"library_version\": " << json_string(srilakshmikanthanp::libfiglet::LIBFIGLET_VERSION) << ",\n";
+#if defined(__VERSION__)
+  out << "    \"compiler\": " << json_string(__VERSION__) << ",\n";
+#endif
+  out << "    \"date\": " << std::time(nullptr) << ",\n";
+  out << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+  out << "    \"simd\": " << static_cast<int>(get_simd()) << "\n";
+  out << "  },\n";
+
+  // results
+  out << "  \"benchmarks\": [\n";
+
+  for (std::size_t i = 0; i < results.size(); ++i)
+  {
+    const auto &result = results[i];
+
+    out << "    {";
+    out << "\"group\": " << json_string(result.group) << ", ";
+    out << "\"name\": " << json_string(result.name) << ", ";
+    out << "\"string_type\": " << json_string(result.string_type) << ", ";
+    out << "\"threads\": " << result.threads << ", ";
+    out << "\"items\": " << result.items << ", ";
+    out << "\"runs\": " << result.runs << ", ";
+    out << "\"best_ms\": " << result.best_ms << ", ";
+    out << "\"mean_ms\": " << result.mean_ms << ", ";
+    out << "\"items_per_second\": " << (result.best_ms > 0 ? result.items / result.best_ms * 1000 : 0);
+    out << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+  }
+
+  out << "  ]\n";
+  out << "}\n";
+}
+
+/**
+ * @brief Load each font of the directory
+ */
+void suite_load_bench(void)
+{
+  for (const auto &font : list_fonts("./assets/fonts"))
+  {
+    const auto name = std::filesystem::path(font).filename().string();
+
+    // fonts that are not supported are not timed
+    try
+    {
+      flf_font::make_shared(font);
+      wflf_font::make_shared(font);
+    }
+    catch (const std::exception &)
+    {
+      continue;
+    }
+
+    record("load", name, "string", 1, 1, [&]{ flf_font::make_shared(font); }, 3);
+    record("load", name, "wstring", 1, 1, [&]{ wflf_font::make_shared(font); }, 3);
+  }
+}
+
+/**
+ * @brief Render short, medium and long inputs with each style
+ */
+template <class string_type>
+void suite_render_bench(const std::string &type)
+{
+  using font_type    = basic_flf_font<string_type>;
+  using figlet_type  = basic_figlet<string_type>;
+
+  // font of the renders
+  const auto font = font_type::make_shared("./assets/fonts/Standard.flf");
+
+  // styles of the renders
+  const std::vector<std::pair<std::string, figlet_type>> figlets = {
+    {"full_width", figlet_type(font, basic_full_width_style<string_type>::make_shared())},
+    {"kerning",    figlet_type(font, basic_kerning_style<string_type>::make_shared())},
+    {"smushed",    figlet_type(font, basic_smushed_style<string_type>::make_shared())},
+  };
+
+  // inputs of the renders
+  const std::string sentence = "The quick brown fox jumps over the lazy dog. ";
+
+  std::string medium, long_text;
+
+  while (medium.size() < 100)
+  {
+    medium += sentence;
+  }
+
+  while (long_text.size() < 10000)
+  {
+    long_text += sentence;
+  }
+
+  const std::vector<std::pair<std::string, std::string>> inputs = {
+    {"short",  "Hello, C++"},
+    {"medium", medium.substr(0, 100)},
+    {"10k",    long_text.substr(0, 10000)},
+  };
+
+  // about the same characters for each input
+  for (const auto &[style, figlet] : figlets)
+  {
+    for (const auto &[size, input] : inputs)
+    {
+      const auto text = string_type(input.begin(), input.end());
+      const auto count = std::max<std::size_t>(1, 100000 / text.size());
+
+      string_type value;
+
+      record("render", style + "/" + size, type, 1, count, [&]{
+        for (std::size_t i = 0; i < count; ++i)
+        {
+          figlet.render_into(text, value);
+        }
+      });
+    }
+  }
+}
+
+/**
+ * @brief Render a batch and a document on more and more threads
+ */
+void suite_threads_bench(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // labels of the batch
+  std::vector<std::string> labels;
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    labels.push_back("host-" + std::to_string(i));
+  }
+
+  const std::vector<std::string_view> texts(labels.begin(), labels.end());
+
+  // document of the labels
+  std::string doc;
+
+  for (const auto &label : labels)
+  {
+    doc += label + "\n";
+  }
+
+  // outputs reused across the runs
+  render_batch batch;
+  std::string value;
+
+  // scale from one thread to the hardware concurrency
+  const auto max_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+  {
+    record("threads", "render_batch", "string", threads, labels.size(), [&]{ smushed.render_batch(texts, batch, threads); });
+    record("threads", "render_document", "string", threads, labels.size(), [&]{ smushed.render_document(doc, value, threads); });
+  }
+}
+
+/**
+ * @brief Render requests of a few labels on more and more threads, each
+ * request allocates from the default heap or from a monotonic buffer of
+ * the thread that is dropped at the end of the request
+ */
+void suite_pmr_bench(void)
+{
+  // Font and figlet objects using std::pmr::string
+  const auto flf_font = pmr::flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = pmr::figlet(flf_font, pmr::smushed::make_shared());
+
+  // labels of the requests
+  const std::size_t requests = 5000, per_request = 8;
+  std::vector<std::string> labels;
+
+  for (std::size_t i = 0; i < requests * per_request; ++i)
+  {
+    labels.push_back("host-" + std::to_string(i));
+  }
+
+  // render the labels of the request, buffers and results from the resource
+  const auto render_request = [&](std::size_t request, std::pmr::memory_resource *resource) {
+    pmr::render_buffer buffer(resource);
+    std::pmr::vector<std::pmr::string> values(resource);
+
+    for (std::size_t i = request * per_request; i < (request + 1) * per_request; ++i)
+    {
+      smushed.render_into(labels[i], values.emplace_back(), buffer);
+    }
+  };
+
+  // scale from one thread to the hardware concurrency
+  const auto max_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+  for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+  {
+    record("pmr", "request_heap", "pmr::string", threads, requests, [&]{
+      parallel_for(requests, threads, [&](std::size_t request) {
+        render_request(request, std::pmr::new_delete_resource());
+      });
+    });
+
+    record("pmr", "request_monotonic", "pmr::string", threads, requests, [&]{
+      parallel_for(requests, threads, [&](std::size_t request) {
+        // memory of the thread, the request is dropped at once with the arena
+        static thread_local std::vector<char> memory(64 * 1024);
+        std::pmr::monotonic_buffer_resource arena(memory.data(), memory.size());
+        render_request(request, &arena);
+      });
+    });
+  }
+}
+
+/**
+ * @brief Run the benchmarks
+ *
+ * @details usage: bench [--suite] [--json path], --suite runs only the
+ * suite and --json writes its results as JSON to the path (- is stdout)
+ */
+int main(int argc, char **argv)
+{
+  // options
+  bool suite_only = false;
+  std::string json_path;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    if (std::strcmp(argv[i], "--suite") == 0)
+    {
+      suite_only = true;
+    }
+    else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+    {
+      json_path = argv[++i];
+    }
+    else
+    {
+      std::cerr << "usage: " << argv[0] << " [--suite] [--json path]" << std::endl;
+      return 1;
+    }
+  }
+
+  // results as JSON only on stdout
+  std::ostringstream discard;
+  const auto cout_buf = json_path == "-" ? std::cout.rdbuf(discard.rdbuf()) : nullptr;
+
+  if (!suite_only)
+  {
+    std::cout << "flf_font_bench Start..." << std::endl;
+    flf_font_bench();
+    std::cout << "flf_font_bench Done" << std::endl;
+
+    std::cout << "compiled_font_bench Start..." << std::endl;
+    compiled_font_bench();
+    std::cout << "compiled_font_bench Done" << std::endl;
+
+    std::cout << "figlet_bench Start..." << std::endl;
+    figlet_bench();
+    std::cout << "figlet_bench Done" << std::endl;
+
+    std::cout << "accelerated_bench Start..." << std::endl;
+    accelerated_bench();
+    std::cout << "accelerated_bench Done" << std::endl;
+
+    std::cout << "render_document_bench Start..." << std::endl;
+    render_document_bench();
+    std::cout << "render_document_bench Done" << std::endl;
+
+    std::cout << "render_cache_bench Start..." << std::endl;
+    render_cache_bench();
+    std::cout << "render_cache_bench Done" << std::endl;
+
+    std::cout << "render_batch_bench Start..." << std::endl;
+    render_batch_bench();
+    std::cout << "render_batch_bench Done" << std::endl;
+
+    std::cout << "missing_glyph_bench Start..." << std::endl;
+    missing_glyph_bench();
+    std::cout << "missing_glyph_bench Done" << std::endl;
+
+    std::cout << "simd_bench Start..." << std::endl;
+    simd_bench();
+    std::cout << "simd_bench Done" << std::endl;
+
+    std::cout << "instrument_bench Start..." << std::endl;
+    instrument_bench();
+    std::cout << "instrument_bench Done" << std::endl;
+  }
+
+  std::cout << "suite_load_bench Start..." << std::endl;
+  suite_load_bench();
+  std::cout << "suite_load_bench Done" << std::endl;
+
+  std::cout << "suite_render_bench Start..." << std::endl;
+  suite_render_bench<std::string>("string");
+  suite_render_bench<std::wstring>("wstring");
+  std::cout << "suite_render_bench Done" << std::endl;
+
+  std::cout << "suite_threads_bench Start..." << std::endl;
+  suite_threads_bench();
+  std::cout << "suite_threads_bench Done" << std::endl;
+
+  std::cout << "suite_pmr_bench Start..." << std::endl;
+  suite_pmr_bench();
+  std::cout << "suite_pmr_bench Done" << std::endl;
+
+  // results of the suite
+  if (json_path == "-")
+  {
+    std::cout.rdbuf(cout_buf);
+    write_json(std::cout);
+  }
+  else if (!json_path.empty())
+  {
+    std::ofstream out(json_path);
+    write_json(out);
+  }
+
+  return 0;
+}
@@ -4,11 +4,55 @@
 // https://opensource.org/licenses/MIT
 
 #include "../src/srilakshmikanthanp/libfiglet.hpp"
+#include "../src/srilakshmikanthanp/fonts/embedded/standard.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <memory_resource>
+#include <new>
+#include <sstream>
+#include <thread>
 
 using namespace srilakshmikanthanp::libfiglet;
 
+// gcc flags free of the replaced operator new as mismatched when inlined
+#if defined(__GNUC__)
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE
+#endif
+
+// number of heap allocations
+std::atomic<std::size_t> allocations(0);
+
+/**
+ * @brief Count the heap allocations
+ */
+NOINLINE void *operator new(std::size_t size)
+{
+  allocations += 1;
+
+  if (void *ptr = std::malloc(size ? size : 1))
+  {
+    return ptr;
+  }
+
+  throw std::bad_alloc();
+}
+
+NOINLINE void operator delete(void *ptr) noexcept
+{
+  std::free(ptr);
+}
+
+NOINLINE void operator delete(void *ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
 void flf_font_test(void)
 {
   // using std::string
@@ -28,6 +72,25 @@ void flf_font_test(void)
   }
 }
 
+void load_flf_fonts_test(void)
+{
+  // using std::string
+  const auto fonts = load_flf_fonts<std::string>(std::filesystem::path("./assets/fonts"));
+
+  // every font is loaded or reported
+  if (fonts.fonts.size() + fonts.errors.size() == 0 || fonts.fonts.count("Standard") == 0)
+  {
+    throw std::runtime_error("Fonts not loaded");
+  }
+
+  // using std::wstring
+  const auto wfonts = load_flf_fonts<std::wstring>(std::filesystem::path("./assets/fonts"));
+
+  // Print the summary
+  std::cout << "flf_font  loaded : " << fonts.fonts.size()  << ", failed : " << fonts.errors.size()  << std::endl;
+  std::cout << "wflf_font loaded : " << wfonts.fonts.size() << ", failed : " << wfonts.errors.size() << std::endl;
+}
+
 void style_test(void)
 {
   // Font and figlet objects using std::string
@@ -55,27 +118,1248 @@ void style_test(void)
   std::wcout << wsmushed(L"Hello, C++")    <<  std::endl;
 }
 
-int main(void)
+void layout_test(void)
 {
-  try
+  // Full_Layout of Standard is 24463 (smushing with rules 1, 2, 4 and 8)
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+
+  if (flf_font->get_layout() != (fig_layout::SMUSHING | 15) || flf_font->get_shrink_level() != shrink_type::SMUSHED)
   {
-    std::cout << "flf_font_test Start..." << std::endl;
-    flf_font_test();
-    std::cout << "flf_font_test Done" << std::endl;
+    throw std::runtime_error("Layout not match");
   }
-  catch(const std::exception& e)
+
+  // Full_Layout overrides the Old_Layout of Georgi16 (15 and 0)
+  if (flf_font::make_shared("./assets/fonts/Georgi16.flf")->get_shrink_level() != shrink_type::FULL_WIDTH)
   {
-    std::cout << "font Test Failed : " << e.what() << '\n';
+    throw std::runtime_error("Full layout not used");
   }
 
-  try
+  // Big X is not a rule of Standard
+  std::cout << figlet(flf_font, smushed::make_shared())("/\\/><") << std::endl;
+}
+
+void render_into_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // buffers of the caller
+  std::string value;
+  std::vector<char> out(1024);
+
+  // warm up the buffers
+  smushed.render_into("Hello, C++", value);
+  smushed.render_to("Hello, C++", out.begin());
+
+  // must be same as operator()
+  if (value != smushed("Hello, C++"))
   {
-    std::cout << "style_test Start..." << std::endl;
-    style_test();
-    std::cout << "style_test Done" << std::endl;
+    throw std::runtime_error("render_into not match");
   }
-  catch(const std::exception& e)
+
+  // render without allocation
+  const auto before = allocations.load();
+
+  for (int i = 0; i < 100; ++i)
   {
-    std::cout << "Style Test Failed : " << e.what() << '\n';
+    smushed.render_into("Hello, C++", value);
+    smushed.render_to("C++", out.begin());
+  }
+
+  if (allocations.load() != before)
+  {
+    throw std::runtime_error("render allocated " + std::to_string(allocations.load() - before) + " times");
+  }
+
+  // Print the Figlet using std::string
+  std::cout << value << std::endl;
+}
+
+void compiled_font_test(void)
+{
+  // compile the fonts using std::string
+  const auto base_dir_path = "./assets/fonts";
+  const auto out_dir_path  = (std::filesystem::temp_directory_path() / "libfiglet_test").string();
+
+  compile_flf_fonts<std::string>(base_dir_path, out_dir_path);
+
+  // compiled font must be same as the flf font
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto compiled = compiled_font::make_shared(out_dir_path + "/Standard.flfc");
+
+  for (char ch = ' '; ch <= '~'; ++ch)
+  {
+    if (flf_font->get_fig_char(ch) != compiled->get_fig_char(ch))
+    {
+      throw std::runtime_error("Compiled fig char not match");
+    }
+  }
+
+  // Deutsch and code tagged fig chars are kept
+  if (flf_font->get_code_points() != compiled->get_code_points())
+  {
+    throw std::runtime_error("Compiled code points not match");
+  }
+
+  for (const auto code : flf_font->get_code_points())
+  {
+    const auto flf_view = flf_font->get_code_view(code);
+    const auto compiled_view = compiled->get_code_view(code);
+
+    for (std::size_t i = 0; i < flf_font->get_height(); ++i)
+    {
+      if (flf_view[i] != compiled_view[i])
+      {
+        throw std::runtime_error("Compiled code fig char not match");
+      }
+    }
+  }
+
+  // malformed headers are rejected (the row of the shrink one makes its size valid)
+  const compiled_font_header wrapped = {{'F', 'I', 'G', 'C'}, 1, compiled_font::version, 1, '$', 1, 0, 0, 0, 0xFFFFFFFF, 0, 0};
+  const compiled_font_header shrink = {{'F', 'I', 'G', 'C'}, 1, compiled_font::version, 1, '$', 1, 7, 0, 0, 0, 0, 0};
+  const fig_row_type row = {0, 0, 0, 0};
+
+  for (const auto &header : {wrapped, shrink})
+  {
+    std::ofstream ofs(out_dir_path + "/Invalid.flfc", std::ios::binary);
+    ofs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    ofs.write(reinterpret_cast<const char *>(&row), header.last_char == 0 ? sizeof(row) : 0);
+    ofs.close();
+
+    try
+    {
+      compiled_font::make_shared(out_dir_path + "/Invalid.flfc");
+      throw std::logic_error("Invalid compiled font loaded");
+    }
+    catch (const std::runtime_error &)
+    {
+      // rejected
+    }
+  }
+
+  // Print the Figlet using std::string
+  std::cout << figlet(compiled, smushed::make_shared())("Hello, C++") << std::endl;
+
+  // compile the fonts using std::wstring
+  const auto wout_dir_path = (std::filesystem::temp_directory_path() / "libfiglet_wtest").string();
+
+  compile_flf_fonts<std::wstring>(base_dir_path, wout_dir_path);
+
+  // Print the Figlet using std::wstring
+  const auto wcompiled = wcompiled_font::make_shared(wout_dir_path + "/Standard.flfc");
+  std::wcout << wfiglet(wcompiled, wsmushed::make_shared())(L"Hello, C++") << std::endl;
+}
+
+void embedded_font_test(void)
+{
+  // embedded font must be same as the flf font
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto embedded = standard_font::make_shared();
+
+  for (char ch = ' '; ch <= '~'; ++ch)
+  {
+    if (flf_font->get_fig_char(ch) != embedded->get_fig_char(ch))
+    {
+      throw std::runtime_error("Embedded fig char not match");
+    }
+  }
+
+  // Banners rendered at compile time
+  constexpr auto full_width = standard_font::render<standard_font::measure("Hello, C++", shrink_type::FULL_WIDTH)>("Hello, C++", shrink_type::FULL_WIDTH);
+  constexpr auto kerning    = standard_font::render<standard_font::measure("Hello, C++", shrink_type::KERNING)>("Hello, C++", shrink_type::KERNING);
+
+  // must be same as the run time banners
+  if (std::string(full_width.begin(), full_width.end()) != figlet(embedded, full_width::make_shared())("Hello, C++"))
+  {
+    throw std::runtime_error("Compile time full width banner not match");
+  }
+
+  if (std::string(kerning.begin(), kerning.end()) != figlet(embedded, kerning::make_shared())("Hello, C++"))
+  {
+    throw std::runtime_error("Compile time kerning banner not match");
+  }
+
+  // Print the Figlet using std::string
+  std::cout << std::string(kerning.begin(), kerning.end()) << std::endl;
+
+  // Print the Figlet using std::wstring
+  std::wcout << wfiglet(wstandard_font::make_shared(), wsmushed::make_shared())(L"Hello, C++") << std::endl;
+}
+
+void font_registry_test(void)
+{
+  // registry of the fonts
+  font_registry registry;
+  registry.index("./assets/fonts");
+
+  // the font is shared
+  const auto standard = registry.get("Standard");
+
+  if (registry.get("Standard") != standard)
+  {
+    throw std::runtime_error("Registry font not shared");
+  }
+
+  // every spelling of the path is the same font
+  const auto absolute = std::filesystem::absolute("./assets/fonts/Standard.flf").string();
+
+  if (registry.get(absolute) != standard || registry.get("./assets/../assets/fonts/Standard.flf") != standard || !registry.contains(absolute))
+  {
+    throw std::runtime_error("Registry font path not shared");
+  }
+
+  // evict when the limit is reached
+  registry.set_memory_limit(standard->get_memory_usage());
+  registry.get("Slant");
+
+  const auto stats = registry.get_stats();
+
+  if (stats.hits != 3 || stats.misses != 2 || stats.evictions != 1)
+  {
+    throw std::runtime_error("Registry stats not match");
+  }
+
+  // evicted font in use is still shared
+  if (registry.get("Standard") != standard)
+  {
+    throw std::runtime_error("Evicted font not shared");
+  }
+
+  // Print the Figlet using std::string
+  std::cout << figlet(registry.get("Slant"), smushed::make_shared())("Hello, C++") << std::endl;
+}
+
+void accelerated_style_test(void)
+{
+  // text with every fig char
+  std::string text;
+
+  for (char ch = ' '; ch <= '~'; ++ch)
+  {
+    text += ch;
+  }
+
+  // accelerated styles must be same as the base styles
+  for (const auto font_path : {"./assets/fonts/Standard.flf", "./assets/fonts/Slant.flf", "./assets/fonts/Big.flf"})
+  {
+    const auto flf_font = flf_font::make_shared(font_path);
+
+    if (figlet(flf_font, kerning::make_shared())(text) != figlet(flf_font, accelerated_kerning::make_shared(flf_font))(text))
+    {
+      throw std::runtime_error("Accelerated kerning not match");
+    }
+
+    if (figlet(flf_font, smushed::make_shared())(text) != figlet(flf_font, accelerated_smushed::make_shared(flf_font))(text))
+    {
+      throw std::runtime_error("Accelerated smushed not match");
+    }
+  }
+
+  // Print the Figlet using std::wstring
+  const auto wflf_font = wflf_font::make_shared("./assets/fonts/Standard.flf");
+  std::wcout << wfiglet(wflf_font, waccelerated_smushed::make_shared(wflf_font))(L"Hello, C++") << std::endl;
+}
+
+void measure_test(void)
+{
+  // fonts to measure with
+  std::vector<figlet::base_figlet_font_ptr> fonts;
+
+  for (const auto font_path : {"./assets/fonts/Standard.flf", "./assets/fonts/Slant.flf", "./assets/fonts/Big.flf"})
+  {
+    fonts.push_back(flf_font::make_shared(font_path));
+  }
+
+  // text with every fig char
+  std::string text;
+
+  for (char ch = ' '; ch <= '~'; ++ch)
+  {
+    text += ch;
+  }
+
+  // size must be same as the rendered figlet string
+  const std::vector<figlet::base_figlet_style_ptr> styles = {full_width::make_shared(), kerning::make_shared(), smushed::make_shared()};
+
+  for (const auto &style : styles)
+  {
+    const auto sizes = figlet::measure(fonts, style, text);
+
+    for (std::size_t i = 0; i < fonts.size(); ++i)
+    {
+      figlet::render_buffer_type buffer;
+      const auto &fig_str = figlet(fonts[i], style).render(text, buffer);
+
+      std::size_t width = 0;
+
+      for (const auto &row : fig_str)
+      {
+        width = std::max(width, row.size());
+      }
+
+      if (!sizes[i] || sizes[i]->width != width || sizes[i]->height != fig_str.size())
+      {
+        throw std::runtime_error("Size not match");
+      }
+    }
+  }
+
+  // font that cannot take the style is flagged, others are measured
+  fonts.push_back(flf_font::make_shared("./assets/fonts/Georgi16.flf"));
+
+  const auto sizes = figlet::measure(fonts, kerning::make_shared(), "Hello");
+
+  if (sizes.size() != fonts.size() || sizes.back() || !sizes.front() || sizes.front()->width != figlet(fonts.front(), kerning::make_shared()).measure("Hello").width)
+  {
+    throw std::runtime_error("Unsuitable font not flagged");
+  }
+
+  // text with a missing fig char
+  if (figlet::measure(fonts, smushed::make_shared(), "\t").front())
+  {
+    throw std::runtime_error("Missing fig char not flagged");
+  }
+
+  // Print the size using std::wstring
+  const auto wflf_font = wflf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto size = wfiglet(wflf_font, wsmushed::make_shared()).measure(L"Hello, C++");
+  std::cout << "Hello, C++ : " << size.width << "x" << size.height << std::endl;
+}
+
+void figlet_stream_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // long text with new lines
+  std::string text;
+
+  for (int i = 0; i < 100; ++i)
+  {
+    text += "The quick brown fox jumps over the lazy dog\n";
+  }
+
+  // render word wrapped at 80 columns
+  std::istringstream in(text);
+  std::ostringstream out;
+
+  render_stream(smushed, in, out, 80);
+
+  // every row must fit the width
+  std::istringstream rows(out.str());
+  std::size_t count = 0;
+
+  for (std::string row; std::getline(rows, row); ++count)
+  {
+    if (row.size() > 80)
+    {
+      throw std::runtime_error("Row wider than the width");
+    }
+  }
+
+  if (count % flf_font->get_height() != 0 || count <= 100 * flf_font->get_height())
+  {
+    throw std::runtime_error("FIGlines not wrapped");
+  }
+
+  // chunks must be same as the whole text
+  std::ostringstream chunked;
+
+  {
+    figlet_stream stream(smushed, chunked, 80);
+
+    for (std::size_t i = 0; i < text.size(); i += 7)
+    {
+      stream << std::string_view(text).substr(i, 7);
+    }
+  }
+
+  if (chunked.str() != out.str())
+  {
+    throw std::runtime_error("Chunked stream not match");
+  }
+
+  // missing glyph without new line drops its FIGline and the rest still wraps
+  std::ostringstream dropped;
+  std::string words = "\x01";
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    words += "word ";
+  }
+
+  {
+    figlet_stream stream(smushed, dropped, 80);
+    stream << words;
+
+    if (!stream.get_error())
+    {
+      throw std::runtime_error("Missing glyph of stream not reported");
+    }
+  }
+
+  std::istringstream dropped_rows(dropped.str());
+  count = 0;
+
+  for (std::string row; std::getline(dropped_rows, row); ++count)
+  {
+    if (row.size() > 80)
+    {
+      throw std::runtime_error("Row wider than the width");
+    }
+  }
+
+  if (count % flf_font->get_height() != 0 || count < 100 * flf_font->get_height())
+  {
+    throw std::runtime_error("FIGlines after the missing glyph not wrapped");
+  }
+
+  // Print the Figlet using std::wstring
+  const auto wflf_font = wflf_font::make_shared("./assets/fonts/Standard.flf");
+  wfiglet_stream wstream(wfiglet(wflf_font, wsmushed::make_shared()), std::wcout, 40);
+  wstream << L"Hello, C++ streams";
+}
+
+void render_document_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // document and the FIGlines rendered one by one
+  std::string doc, expected;
+
+  for (int i = 0; i < 500; ++i)
+  {
+    const auto line = "Line " + std::to_string(i) + (i % 3 ? " of the document" : "");
+    doc += line + (i % 7 ? "\n" : "\r\n");
+    expected += smushed(line);
+  }
+
+  // must be same as rendered one by one
+  for (const std::size_t threads : {1, 2, 4, 0})
+  {
+    if (smushed.render_document(doc, threads) != expected)
+    {
+      throw std::runtime_error("Document not match with " + std::to_string(threads) + " threads");
+    }
+  }
+
+  // Print the Figlet using std::wstring
+  const auto wflf_font = wflf_font::make_shared("./assets/fonts/Standard.flf");
+  std::wcout << wfiglet(wflf_font, wsmushed::make_shared()).render_document(L"Hello,\nC++") << std::endl;
+}
+
+void shared_style_test(void)
+{
+  // one style shared by the figlets of different fonts
+  const auto style = smushed::make_shared();
+
+  std::vector<figlet> figlets;
+
+  for (const auto font_path : {"./assets/fonts/Standard.flf", "./assets/fonts/Slant.flf", "./assets/fonts/Big.flf", "./assets/fonts/Shadow.flf"})
+  {
+    figlets.emplace_back(flf_font::make_shared(font_path), style);
+  }
+
+  // rendered one by one
+  std::vector<std::string> expected;
+
+  for (const auto &figlet : figlets)
+  {
+    expected.push_back(figlet("Hello, C++"));
+  }
+
+  // rendered on the threads at the same time
+  std::atomic<int> errors(0);
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 200; ++i)
+      {
+        const auto k = (t + i) % figlets.size();
+
+        if (figlets[k]("Hello, C++") != expected[k])
+        {
+          errors++;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  if (errors.load() != 0)
+  {
+    throw std::runtime_error("Shared style not match");
+  }
+
+  // Print the Figlet using std::string
+  std::cout << figlets[1]("Hello, C++") << std::endl;
+}
+
+void render_cache_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+  const auto kerning  = figlet(flf_font, kerning::make_shared());
+
+  // cache of 64 results
+  render_cache cache(64, 4);
+
+  // must be same as operator() and shared on a hit
+  const auto value = cache.render(smushed, "Hello, C++");
+
+  if (*value != smushed("Hello, C++") || cache.render(smushed, "Hello, C++") != value)
+  {
+    throw std::runtime_error("Cached result not match");
+  }
+
+  // style is part of the key
+  if (*cache.render(kerning, "Hello, C++") != kerning("Hello, C++"))
+  {
+    throw std::runtime_error("Cached style not match");
+  }
+
+  // missing glyph policy is part of the key
+  auto skip = figlet(flf_font, smushed::make_shared());
+  auto substitute = figlet(flf_font, smushed::make_shared());
+
+  skip.set_missing_glyph(missing_glyph_type::SKIP);
+  substitute.set_missing_glyph(missing_glyph_type::SUBSTITUTE, '?');
+
+  std::string expected;
+  substitute.render_into("a\tb", expected);
+
+  if (*cache.render(skip, "a\tb") == expected || *cache.render(substitute, "a\tb") != expected)
+  {
+    throw std::runtime_error("Cached policy not match");
+  }
+
+  // hits and misses
+  if (cache.get_stats().hits != 1 || cache.get_stats().misses != 4 || cache.get_stats().size != 4)
+  {
+    throw std::runtime_error("Cache counters not match");
+  }
+
+  // bounded by the capacity
+  std::vector<std::thread> threads;
+
+  for (std::size_t t = 0; t < 4; ++t)
+  {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 1000; ++i)
+      {
+        cache.render(smushed, "host-" + std::to_string(i % 100));
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  const auto stats = cache.get_stats();
+
+  if (stats.size > 64 || stats.evictions == 0 || stats.hits + stats.misses != 4005)
+  {
+    throw std::runtime_error("Cache not bounded");
+  }
+
+  // Print the counters
+  std::cout << "hits " << stats.hits << ", misses " << stats.misses << ", evictions " << stats.evictions << ", hit rate " << stats.hit_rate() << std::endl;
+}
+
+void render_batch_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // labels of the batch
+  std::vector<std::string> labels;
+
+  for (int i = 0; i < 1000; ++i)
+  {
+    labels.push_back("host-" + std::to_string(i));
+  }
+
+  const std::vector<std::string_view> texts(labels.begin(), labels.end());
+
+  // must be same as operator()
+  for (const std::size_t threads : {1, 4})
+  {
+    const auto batch = smushed.render_batch(texts, threads);
+
+    if (batch.size() != labels.size())
+    {
+      throw std::runtime_error("Batch size not match");
+    }
+
+    for (std::size_t i = 0; i < labels.size(); ++i)
+    {
+      if (batch[i] != smushed(labels[i]))
+      {
+        throw std::runtime_error("Batch not match");
+      }
+    }
+  }
+
+  // Print the Figlet using std::wstring
+  const auto wflf_font = wflf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto wbatch = wfiglet(wflf_font, wsmushed::make_shared()).render_batch({L"Hello,", L"C++"});
+  std::wcout << wbatch[0] << wbatch[1] << std::endl;
+}
+
+void unicode_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto smushed  = figlet(flf_font, smushed::make_shared());
+
+  // Deutsch and code tagged fig chars
+  if (flf_font->get_code_view(0x017D)[1] != " |__  /" || flf_font->get_code_view(0xCA0)[2] != "  / _ \\  ")
+  {
+    throw std::runtime_error("Code tagged fig char not match");
+  }
+
+  // UTF-8 and Latin-1 input
+  if (smushed("\xC3\x84pfel") != smushed("\xC4pfel"))
+  {
+    throw std::runtime_error("UTF-8 not match");
+  }
+
+  // same as std::wstring
+  const auto wflf_font = wflf_font::make_shared("./assets/fonts/Standard.flf");
+  const auto wsmushed  = wfiglet(wflf_font, wsmushed::make_shared());
+
+  const auto value  = smushed("Gr\xC3\xBC\xC3\x9F \xC5\xBD \xE0\xB2\xA0");
+  const auto wvalue = wsmushed(L"Gr\u00FC\u00DF \u017D \u0CA0");
+
+  if (value != std::string(wvalue.begin(), wvalue.end()))
+  {
+    throw std::runtime_error("UTF-8 not match std::wstring");
+  }
+
+  // missing fig char
+  try
+  {
+    smushed("\xE2\x82\xAC");
+    throw std::logic_error("Missing fig char rendered");
+  }
+  catch (const std::runtime_error &)
+  {
+    // expected
+  }
+
+  // Print the Figlet using std::string
+  std::cout << value << std::endl;
+}
+
+void missing_glyph_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+  auto smushed = figlet(flf_font, smushed::make_shared());
+
+  // fail by default
+  std::string value = "not empty";
+  std::error_code ec;
+
+  smushed.render_into("A\tB", value, ec);
+
+  if (!ec || !value.empty())
+  {
+    throw std::runtime_error("Missing glyph not reported");
+  }
+
+  smushed.render_into("AB", value, ec);
+
+  if (ec || value != smushed("AB"))
+  {
+    throw std::runtime_error("Error code not cleared");
+  }
+
+  // batch, document and measure report it on one and more threads
+  std::vector<std::string_view> texts(200, "AB");
+  texts[150] = "A\tB";
+
+  for (const std::size_t threads : {1, 4})
+  {
+    render_batch batch;
+    smushed.render_batch(texts, batch, threads, ec);
+
+    if (!ec || batch.size() != 0)
+    {
+      throw std::runtime_error("Missing glyph of batch not reported");
+    }
+
+    smushed.render_document("AB\nA\tB", value, threads, ec);
+
+    if (!ec || !value.empty())
+    {
+      throw std::runtime_error("Missing glyph of document not reported");
+    }
+
+    try
+    {
+      smushed.render_batch(texts, threads);
+      throw std::logic_error("Missing glyph of batch not thrown");
+    }
+    catch (const std::runtime_error &error)
+    {
+      if (std::string(error.what()) != "Invalid character : 9")
+      {
+        throw;
+      }
+    }
+  }
+
+  if (smushed.measure("A\tB", ec).width != 0 || !ec || smushed.measure("AB", ec).width == 0 || ec)
+  {
+    throw std::runtime_error("Missing glyph of measure not reported");
+  }
+
+  // stream reports the failed FIGline and writes the next ones
+  std::ostringstream failed;
+
+  {
+    figlet_stream stream(smushed, failed, 80);
+    stream << "A\x01B\nAB\n";
+
+    if (!stream.get_error())
+    {
+      throw std::runtime_error("Missing glyph of stream not reported");
+    }
+  }
+
+  if (failed.fail() || failed.str() != smushed("AB"))
+  {
+    throw std::runtime_error("FIGline after the missing glyph not written");
+  }
+
+  // skip the characters
+  smushed.set_missing_glyph(missing_glyph_type::SKIP);
+
+  if (smushed("A\tB\x01") != smushed("AB"))
+  {
+    throw std::runtime_error("Missing glyph not skipped");
+  }
+
+  // substitute with the fallback
+  smushed.set_missing_glyph(missing_glyph_type::SUBSTITUTE, '?');
+
+  if (smushed("A\tB") != smushed("A?B") || smushed.render_batch({"A\tB"})[0] != smushed("A?B"))
+  {
+    throw std::runtime_error("Missing glyph not substituted");
+  }
+
+  // Print the Figlet using std::string
+  std::cout << smushed("Tab\there") << std::endl;
+}
+
+void simd_test(void)
+{
+  // rows of every length with hard blanks
+  for (std::size_t n = 0; n < 100; ++n)
+  {
+    std::string row, scalar(n, '\0'), vector(n, '\0');
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      row += i % 3 == 0 ? '$' : char('a' + i % 26);
+    }
+
+    for (const auto type : {simd_type::SSE2, simd_type::AVX2})
+    {
+      set_simd(simd_type::SCALAR);
+      copy_replace(scalar.data(), row.data(), n, '$', ' ');
+      set_simd(type);
+      copy_replace(vector.data(), row.data(), n, '$', ' ');
+
+      if (scalar != vector)
+      {
+        throw std::runtime_error("Copy not match");
+      }
+    }
+  }
+
+  // text with every fig char
+  std::string text;
+
+  for (char ch = ' '; ch <= '~'; ++ch)
+  {
+    text += ch;
+  }
+
+  const std::wstring wtext(text.begin(), text.end());
+
+  // every font must be same with the scalar path
+  const auto fonts = load_flf_fonts<std::string>(std::filesystem::path("./assets/fonts"));
+  const auto wfonts = load_flf_fonts<std::wstring>(std::filesystem::path("./assets/fonts"));
+
+  const auto render_all = [&](simd_type type) {
+    std::vector<std::string> result;
+    std::vector<std::wstring> wresult;
+
+    set_simd(type);
+
+    for (const auto &[name, font] : fonts.fonts)
+    {
+      result.push_back(figlet(font, full_width::make_shared())(text));
+      if (font->get_shrink_level() != shrink_type::FULL_WIDTH)
+      {
+        result.push_back(figlet(font, kerning::make_shared())(text));
+      }
+    }
+
+    for (const auto &[name, font] : wfonts.fonts)
+    {
+      wresult.push_back(wfiglet(font, wfull_width::make_shared())(wtext));
+      if (font->get_shrink_level() != shrink_type::FULL_WIDTH)
+      {
+        wresult.push_back(wfiglet(font, wkerning::make_shared())(wtext));
+      }
+    }
+
+    return std::make_pair(result, wresult);
+  };
+
+  const auto scalar = render_all(simd_type::SCALAR);
+
+  for (const auto type : {simd_type::SSE2, simd_type::AVX2})
+  {
+    if (render_all(type) != scalar)
+    {
+      throw std::runtime_error("Render not match");
+    }
+  }
+
+  // Print the instruction set
+  std::cout << "simd : " << static_cast<int>(set_simd(simd_type::AVX2)) << std::endl;
+}
+
+void fig_grid_test(void)
+{
+  // tall font
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Banner3-D.flf");
+  const auto full_width = figlet(flf_font, full_width::make_shared());
+
+  // rows of the grid
+  figlet::render_buffer_type buffer;
+  const auto &fig_str = full_width.render("Hello, C++", buffer);
+
+  // rows must be same as the joined figlet string
+  std::string value;
+
+  for (const auto &row : fig_str)
+  {
+    value += row;
+    value += '\n';
+  }
+
+  if (fig_str.size() != flf_font->get_height() || value != full_width("Hello, C++"))
+  {
+    throw std::runtime_error("Grid rows not match");
+  }
+
+  // joined in place
+  if (buffer.fig_str.join() != value || !buffer.fig_str.empty())
+  {
+    throw std::runtime_error("Grid join not match");
+  }
+
+  // rows of all the heights of the font do not allocate once the grid has grown
+  full_width.render("Hello, C++ Hello, C++", buffer);
+
+  const auto before = allocations.load();
+
+  for (const auto text : {"H", "Hello", "Hello, C++", "Hello, C++ Hello, C++"})
+  {
+    full_width.render(text, buffer);
+  }
+
+  if (allocations.load() != before)
+  {
+    throw std::runtime_error("Grid allocated " + std::to_string(allocations.load() - before) + " times");
+  }
+
+  // Print the Figlet using std::string
+  std::cout << value << std::endl;
+}
+
+void instrument_test(void)
+{
+  // Font and figlet objects using std::string
+  const auto flf_font = flf_font::make_shared("./assets/fonts/Standard.flf");
+
+  // events of the renders
+  std::vector<render_event> events;
+  const auto smushed = instrumented_figlet(flf_font, smushed::make_shared(), stats_instrument([&](const render_event &event) { events.push_back(event); }));
+
+  // same output as the figlet without instrument
+  if (smushed("Hello, C++") != figlet(flf_font, smushed::make_shared())("Hello, C++"))
+  {
+    throw std::runtime_error("Instrumented render not match");
+  }
+
+  std::string value;
+  smushed.render_into("C++", value);
+  smushed.render_batch({"a", "bc"});
+
+  // missing glyph
+  try
+  {
+    smushed("\t");
+  }
+  catch (const std::exception &)
+  {
+    // recorded as failure
+  }
+
+  // counters of the renders
+  const auto stats = smushed.get_instrument().get_stats();
+
+  if (stats.renders != 5 || events.size() != 5 || stats.failures != 1 || stats.decoded_code_points != 10 + 3 + 1 + 2 + 1 || stats.glyphs != 10 + 3 + 1 + 2)
+  {
+    throw std::runtime_error("Render counts not match");
+  }
+
+  if (events[0].shrink != shrink_type::SMUSHED || events[0].height != flf_font->get_height() || events[0].width != smushed.measure("Hello, C++").width || events[1].output_size != value.size())
+  {
+    throw std::runtime_error("Render sizes not match");
+  }
+
+  if (stats.smushing_ns == 0 || stats.kerning_ns != 0 || stats.max_width != events[0].width)
+  {
+    throw std::runtime_error("Render phases not match");
+  }
+
+  // copies share the counters
+  smushed.get_instrument().reset();
+  const auto copy = smushed;
+  copy("Hi");
+
+  if (smushed.get_instrument().get_stats().renders != 1)
+  {
+    throw std::runtime_error("Counters not shared");
+  }
+
+  // Print the counters
+  std::cout << "lookup " << stats.lookup_ns << " ns, smushing " << stats.smushing_ns << " ns, assembly " << stats.assembly_ns << " ns, buffer growths " << stats.buffer_growths << " (" << stats.buffer_growth_bytes << " bytes)" << std::endl;
+}
+
+void pmr_test(void)
+{
+  // Font with the glyphs in a memory resource
+  std::pmr::monotonic_buffer_resource font_memory;
+  const auto flf_font = pmr::flf_font::make_shared("./assets/fonts/Standard.flf", &font_memory);
+
+  if (flf_font->get_allocator().resource() != &font_memory)
+  {
+    throw std::runtime_error("Font allocator not match");
+  }
+
+  // Figlet and figlet of the std::string
+  const auto smushed = pmr::figlet(flf_font, pmr::accelerated_smushed::make_shared(flf_font, &font_memory));
+  const auto expected = figlet(flf_font::make_shared("./assets/fonts/Standard.flf"), smushed::make_shared())("Hello, C++");
+
+  if (std::string_view(smushed("Hello, C++")) != expected)
+  {
+    throw std::runtime_error("Pmr render not match");
+  }
+
+  // render in a monotonic buffer of the request without the heap
+  char memory[16384];
+  std::pmr::monotonic_buffer_resource arena(memory, sizeof(memory), std::pmr::null_memory_resource());
+
+  const auto before = allocations.load();
+
+  pmr::render_buffer buffer(&arena);
+  std::pmr::string value(&arena);
+  smushed.render_into("Hello, C++", value, buffer);
+
+  if (allocations.load() != before)
+  {
+    throw std::runtime_error("Arena render allocated " + std::to_string(allocations.load() - before) + " times");
+  }
+
+  if (std::string_view(value) != expected || value.get_allocator().resource() != &arena)
+  {
+    throw std::runtime_error("Arena render not match");
+  }
+
+  // value of other resource is copied, not swapped
+  std::pmr::string other(std::pmr::new_delete_resource());
+  smushed.render_into("Hello, C++", other, buffer);
+
+  if (std::string_view(other) != expected || other.get_allocator().resource() != std::pmr::new_delete_resource())
+  {
+    throw std::runtime_error("Other resource render not match");
+  }
+
+  // document rendered in place in the string of the arena on the threads
+  std::pmr::monotonic_buffer_resource doc_memory;
+  std::pmr::string doc(&doc_memory);
+  std::string lines, expected_doc;
+
+  for (int i = 0; i < 200; ++i)
+  {
+    lines += "Hello, C++\n";
+    expected_doc += expected;
+  }
+
+  smushed.render_document(lines, doc, 4);
+
+  if (doc.get_allocator().resource() != &doc_memory || std::string_view(doc) != expected_doc)
+  {
+    throw std::runtime_error("Arena document not match");
+  }
+
+  // Print the Figlet using std::pmr::string
+  std::cout << value << std::endl;
+}
+
+int main(void)
+{
+  try
+  {
+    std::cout << "flf_font_test Start..." << std::endl;
+    flf_font_test();
+    std::cout << "flf_font_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "font Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "load_flf_fonts_test Start..." << std::endl;
+    load_flf_fonts_test();
+    std::cout << "load_flf_fonts_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Load Fonts Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "style_test Start..." << std::endl;
+    style_test();
+    std::cout << "style_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Style Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "layout_test Start..." << std::endl;
+    layout_test();
+    std::cout << "layout_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Layout Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "render_into_test Start..." << std::endl;
+    render_into_test();
+    std::cout << "render_into_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Render Into Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "compiled_font_test Start..." << std::endl;
+    compiled_font_test();
+    std::cout << "compiled_font_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Compiled Font Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "embedded_font_test Start..." << std::endl;
+    embedded_font_test();
+    std::cout << "embedded_font_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Embedded Font Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "font_registry_test Start..." << std::endl;
+    font_registry_test();
+    std::cout << "font_registry_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Font Registry Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "accelerated_style_test Start..." << std::endl;
+    accelerated_style_test();
+    std::cout << "accelerated_style_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Accelerated Style Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "measure_test Start..." << std::endl;
+    measure_test();
+    std::cout << "measure_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Measure Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "figlet_stream_test Start..." << std::endl;
+    figlet_stream_test();
+    std::cout << "figlet_stream_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Figlet Stream Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "render_document_test Start..." << std::endl;
+    render_document_test();
+    std::cout << "render_document_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Render Document Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "shared_style_test Start..." << std::endl;
+    shared_style_test();
+    std::cout << "shared_style_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Shared Style Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "render_cache_test Start..." << std::endl;
+    render_cache_test();
+    std::cout << "render_cache_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Render Cache Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "render_batch_test Start..." << std::endl;
+    render_batch_test();
+    std::cout << "render_batch_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Render Batch Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "unicode_test Start..." << std::endl;
+    unicode_test();
+    std::cout << "unicode_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Unicode Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "missing_glyph_test Start..." << std::endl;
+    missing_glyph_test();
+    std::cout << "missing_glyph_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Missing Glyph Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "simd_test Start..." << std::endl;
+    simd_test();
+    std::cout << "simd_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Simd Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "fig_grid_test Start..." << std::endl;
+    fig_grid_test();
+    std::cout << "fig_grid_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Fig Grid Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "instrument_test Start..." << std::endl;
+    instrument_test();
+    std::cout << "instrument_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Instrument Test Failed : " << e.what() << '\n';
+  }
+
+  try
+  {
+    std::cout << "pmr_test Start..." << std::endl;
+    pmr_test();
+    std::cout << "pmr_test Done" << std::endl;
+  }
+  catch(const std::exception& e)
+  {
+    std::cout << "Pmr Test Failed : " << e.what() << '\n';
   }
 }